@@ -30,6 +30,7 @@
 #include "libmesh/threads.h"
 #include "libmesh/threads_allocators.h"
 #include "libmesh/elem_range.h"
+#include "libmesh/scatter_plan.h"
 #include "libmesh/sparsity_pattern.h"
 
 // C++ Includes   -----------------------------------
@@ -219,6 +220,19 @@ public:
    */
   void clear_sparsity();
 
+  /**
+   * Returns true if the sparsity pattern computed by the last call to
+   * \p compute_sparsity() is still valid for the current mesh and DOF
+   * distribution, in which case matrices built from it may be kept
+   * rather than reallocated.  The test compares a fingerprint of the
+   * dof indices on each active local element, the DOF coupling and the
+   * constraint structure.  It is always false when extra sparsity
+   * callbacks are attached, since we cannot see what they add.
+   *
+   * This must be called on all processors at once.
+   */
+  bool sparsity_is_current (const MeshBase&) const;
+
   /**
    * Attach an object to use to populate the
    * sparsity pattern with extra entries.
@@ -274,7 +288,8 @@ public:
    * Takes the \p _send_list vector (which may have duplicate entries)
    * and sorts it.  The duplicate entries are then removed, resulting in
    * a sorted \p _send_list with unique entries.  Also calls any user-provided
-   * methods for adding to the send list.
+   * methods for adding to the send list, and builds the communication
+   * plan for it, so it must be called on all processors at once.
    */
   void prepare_send_list ();
 
@@ -287,6 +302,13 @@ public:
    */
   const std::vector<unsigned int>& get_send_list() const { return _send_list; }
 
+  /**
+   * Returns a constant reference to the communication plan for
+   * localizing vectors onto the \p _send_list.  It is rebuilt by
+   * \p prepare_send_list().
+   */
+  const ScatterPlan& get_send_list_plan() const { return _send_list_plan; }
+
   /**
    * Returns a constant reference to the \p _n_nz list for this processor.
    * The vector contains the bandwidth of the on-processor coupling for each
@@ -436,6 +458,23 @@ public:
 		    std::vector<unsigned int>& di,
 		    const unsigned int vn = libMesh::invalid_uint) const;
 
+  /**
+   * Turns the dof index cache on or off.  While it is on, every
+   * \p distribute_dofs() stores the dof indices of all active
+   * elements in one flat table, and \p dof_indices() on those
+   * elements just copies a slice of it instead of visiting the
+   * element's nodes.  This costs memory proportional to the number of
+   * element dofs.  The cache is off by default; turning it on takes
+   * effect at the next \p distribute_dofs().
+   */
+  void cache_dof_indices (const bool cache = true);
+
+  /**
+   * Returns true if the dof index cache is on.
+   */
+  bool dof_indices_cached () const
+  { return _cache_dof_indices; }
+
   /**
    * Fills the vector \p di with the global degree of freedom indices
    * corresponding to the SCALAR variable vn. If old_dofs=true,
@@ -874,6 +913,14 @@ private:
    */
   AutoPtr<SparsityPattern::Build> build_sparsity(const MeshBase& mesh) const;
 
+  /**
+   * Computes a hash of everything on this processor that determines
+   * the sparsity pattern: the dof indices of each active local element
+   * (and of its neighbors when they are implicitly coupled), the DOF
+   * coupling matrix and the constraint rows.
+   */
+  unsigned int sparsity_fingerprint(const MeshBase& mesh) const;
+
   /**
    * Invalidates all active DofObject dofs for this system
    */
@@ -930,6 +977,37 @@ private:
   void distribute_local_dofs_node_major (unsigned int& next_free_dof,
 				         MeshBase& mesh);
 
+  /**
+   * Numbers the dofs of variable groups \p vgs on the active local
+   * elements \p elems, in order: each element numbers its own dofs
+   * and those of the local nodes it is the first to reach.  The
+   * elements are counted and then numbered by parallel threads.
+   * Starts at index next_free_dof, and increments it to the
+   * post-final index.
+   */
+  void distribute_local_elem_dofs (unsigned int& next_free_dof,
+				   const MeshBase& mesh,
+				   const std::vector<Elem*>& elems,
+				   const std::vector<unsigned int>& vgs);
+
+  /**
+   * Fills the dof index cache for the active elements of \p mesh.
+   */
+  void build_dof_index_cache (const MeshBase& mesh);
+
+  /**
+   * Empties the dof index cache.
+   */
+  void clear_dof_index_cache ();
+
+  /**
+   * Fills \p di from the dof index cache, and returns true, if
+   * \p elem is in it; otherwise returns false.
+   */
+  bool cached_dof_indices (const Elem* const elem,
+			   std::vector<unsigned int>& di,
+			   const unsigned int vn) const;
+
   /**
    * Adds entries to the \p _send_list vector corresponding to DoFs
    * on elements neighboring the current processor.
@@ -1026,6 +1104,12 @@ private:
    */
   std::vector<unsigned int> _send_list;
 
+  /**
+   * The communication plan for localizing vectors onto the
+   * \p _send_list.
+   */
+  ScatterPlan _send_list_plan;
+
   /**
    * Funtion object to call to add extra entries to the sparsity pattern
    */
@@ -1084,6 +1168,40 @@ private:
    */
   std::vector<unsigned int>* _n_oz;
 
+  /**
+   * The \p sparsity_fingerprint() of the mesh and DOF distribution
+   * the current sparsity pattern was computed for.  Only meaningful
+   * when \p _have_sparsity_fingerprint is true.
+   */
+  unsigned int _sparsity_fingerprint;
+
+  /**
+   * True between \p compute_sparsity() and \p clear_sparsity().
+   */
+  bool _have_sparsity_fingerprint;
+
+  /**
+   * True if \p distribute_dofs() should build the dof index cache.
+   */
+  bool _cache_dof_indices;
+
+  /**
+   * The dof index cache.  The indices of variable \p v on the
+   * cached element in slot \p i are
+   * _dof_index_cache[_dof_index_cache_offsets[i*n_vars+v]] up to
+   * (but not including) _dof_index_cache[_dof_index_cache_offsets[i*n_vars+v+1]].
+   * SCALAR variables have empty entries.
+   */
+  std::vector<unsigned int> _dof_index_cache;
+  std::vector<unsigned int> _dof_index_cache_offsets;
+
+  /**
+   * The element in each slot of the cache, and the slot of each
+   * element id (or \p invalid_uint).
+   */
+  std::vector<const Elem*> _dof_index_cache_elems;
+  std::vector<unsigned int> _dof_index_cache_slots;
+
   /**
    * Total number of degrees of freedom.
    */
@@ -25,6 +25,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/small_vector.h"
 
 // C++ includes
 #include <cstddef>
@@ -420,9 +421,15 @@ private:
    * *within the system*. So for a system with 2 variable groups, 4 and 8 variables each,
    * the 5th variable in the system is the 1st variable in 2nd variable group.
    * (Now of course 0-base everything...  but you get the idea.)
+   *
+   * The buffer keeps up to 4 entries inside the object, enough for
+   * one system of one variable group, so that the common case needs
+   * no heap allocation per \p Node and \p Elem.  This fits in the
+   * room a \p std::vector header took, so \p sizeof(DofObject) does
+   * not grow.
    */
   typedef unsigned int index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  typedef SmallVector<index_t, 4> index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -450,7 +457,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<unsigned int> &buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -56,9 +56,13 @@ class PerfLog;
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
 
 // Note the log is in libMesh, so we need to include it.
+// Each call site caches the id of its event, so string literal
+// labels are only looked up the first time through.
 #  include "libmesh/libmesh.h"
-#  define START_LOG(a,b)   { libMesh::perflog.push(a,b); }
-#  define STOP_LOG(a,b)    { libMesh::perflog.pop(a,b); }
+#  define START_LOG(a,b)   { static libMesh::PerfEventCache libmesh_perf_event; \
+                             libMesh::perflog.push(libmesh_perf_event,a,b); }
+#  define STOP_LOG(a,b)    { static libMesh::PerfEventCache libmesh_perf_event; \
+                             libMesh::perflog.pop(libmesh_perf_event,a,b); }
 #  define PALIBMESH_USE_LOG(a,b)   { libmesh_deprecated(); }
 #  define RESTART_LOG(a,b) { libmesh_deprecated(); }
 
@@ -50,6 +50,94 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
 
   class NonlocalGraph : public std::map<unsigned int, Row> {};
 
+  /**
+   * A compressed row storage (CSR) version of the sparsity pattern.
+   * The global column indices of local row i are stored contiguously in
+   * \p col_indices, starting at \p row_offsets[i] and ending just
+   * before \p row_offsets[i+1].  The whole graph therefore lives in two
+   * allocations instead of one allocation per row, and can be handed
+   * directly to sparse matrix formats which store their structure
+   * the same way.
+   */
+  class CompressedGraph
+  {
+  public:
+
+    typedef std::vector<unsigned int>::const_iterator const_iterator;
+
+    /**
+     * Constructor.  Builds an empty graph with no rows.
+     */
+    CompressedGraph () :
+      row_offsets(1, 0),
+      col_indices()
+    {}
+
+    /**
+     * Returns the number of rows in the graph.
+     */
+    unsigned int n_rows () const
+    { return static_cast<unsigned int>(row_offsets.size()) - 1; }
+
+    /**
+     * Returns the total number of nonzeros in the graph.
+     */
+    unsigned int n_nonzeros () const
+    { return static_cast<unsigned int>(col_indices.size()); }
+
+    /**
+     * Returns the number of nonzeros in row \p i.
+     */
+    unsigned int row_size (const unsigned int i) const
+    {
+      libmesh_assert_less (i+1, row_offsets.size());
+      return row_offsets[i+1] - row_offsets[i];
+    }
+
+    /**
+     * Returns an iterator to the first column index of row \p i.
+     */
+    const_iterator row_begin (const unsigned int i) const
+    {
+      libmesh_assert_less (i+1, row_offsets.size());
+      return col_indices.begin() + row_offsets[i];
+    }
+
+    /**
+     * Returns an iterator one past the last column index of row \p i.
+     */
+    const_iterator row_end (const unsigned int i) const
+    {
+      libmesh_assert_less (i+1, row_offsets.size());
+      return col_indices.begin() + row_offsets[i+1];
+    }
+
+    /**
+     * Frees all memory and leaves a graph with no rows.
+     */
+    void clear ()
+    {
+      std::vector<unsigned int>(1, 0).swap(row_offsets);
+      std::vector<unsigned int>().swap(col_indices);
+    }
+
+    /**
+     * Copies the row-by-row \p graph into compressed form.
+     */
+    void assign (const Graph &graph);
+
+    /**
+     * Offsets into \p col_indices of the beginning of each row.
+     * Has \p n_rows()+1 entries; the last one is \p n_nonzeros().
+     */
+    std::vector<unsigned int> row_offsets;
+
+    /**
+     * The column indices of every row, packed back to back.
+     */
+    std::vector<unsigned int> col_indices;
+  };
+
   /**
    * Splices the two sorted ranges [begin,middle) and [middle,end)
    * into one sorted range [begin,end).  This method is much like
@@ -84,10 +172,33 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
     const bool implicit_neighbor_dofs;
     const bool need_full_sparsity_pattern;
 
+    /**
+     * The local rows built into \p sparsity_pattern, which holds row
+     * \p row_begin first, and whether rows owned by other processors
+     * are built into \p nonlocal_pattern.  By default every row is.
+     */
+    unsigned int row_begin;
+    unsigned int row_end;
+    bool keep_nonlocal_rows;
+
+    /**
+     * @returns the row for dof \p ig, or \p NULL if that row is not
+     * being built.
+     */
+    SparsityPattern::Row * find_row (const unsigned int ig);
+
+    /**
+     * Adds the couplings of the elements in [\p elem_begin,
+     * \p elem_end) to the rows being built.
+     */
+    void add_elements (ConstElemRange::const_iterator elem_begin,
+		       ConstElemRange::const_iterator elem_end);
+
   public:
 
     SparsityPattern::Graph sparsity_pattern;
     SparsityPattern::NonlocalGraph nonlocal_pattern;
+    SparsityPattern::CompressedGraph compressed_pattern;
 
     std::vector<unsigned int> n_nz;
     std::vector<unsigned int> n_oz;
@@ -96,17 +207,7 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
 	   const DofMap &dof_map_in,
 	   const CouplingMatrix *dof_coupling_in,
 	   const bool implicit_neighbor_dofs_in,
-	   const bool need_full_sparsity_pattern_in) :
-      mesh(mesh_in),
-      dof_map(dof_map_in),
-      dof_coupling(dof_coupling_in),
-      implicit_neighbor_dofs(implicit_neighbor_dofs_in),
-      need_full_sparsity_pattern(need_full_sparsity_pattern_in),
-      sparsity_pattern(),
-      nonlocal_pattern(),
-      n_nz(),
-      n_oz()
-    {}
+	   const bool need_full_sparsity_pattern_in);
 
     Build (Build &other, Threads::split) :
       mesh(other.mesh),
@@ -114,8 +215,12 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
       dof_coupling(other.dof_coupling),
       implicit_neighbor_dofs(other.implicit_neighbor_dofs),
       need_full_sparsity_pattern(other.need_full_sparsity_pattern),
+      row_begin(other.row_begin),
+      row_end(other.row_end),
+      keep_nonlocal_rows(other.keep_nonlocal_rows),
       sparsity_pattern(),
       nonlocal_pattern(),
+      compressed_pattern(),
       n_nz(),
       n_oz()
     {}
@@ -125,6 +230,52 @@ namespace SparsityPattern // use a namespace so member classes can be forward-de
     void join (const Build &other);
 
     void parallel_sync ();
+
+    /**
+     * Computes the full sparsity pattern of the elements in \p range
+     * straight into \p compressed_pattern, along with \p n_nz and
+     * \p n_oz, without building \p sparsity_pattern.  The local rows
+     * are built a block at a time, from the elements with dofs in
+     * that block, and each block is packed into a column array of its
+     * own as soon as it is built.  Once the total is known the column
+     * array is allocated exactly once and the blocks are moved into
+     * it one at a time, so only a few blocks of rows are ever held as
+     * a \p Graph.
+     *
+     * This function is collective and therefore must be called by all
+     * processors.
+     */
+    void build_compressed (const ConstElemRange &range);
+
+    /**
+     * Fills \p dofs with the dofs of \p elem, and the dofs they are
+     * constrained in terms of: the rows the element adds to.
+     */
+    void element_row_dofs (const Elem *elem,
+			   std::vector<unsigned int> &dofs) const;
+
+    /**
+     * Builds the local rows [\p first_row, \p end_row) into
+     * \p sparsity_pattern from the elements \p elems, and merges in
+     * the rows \p received from other processors.  Used by
+     * \p build_compressed().
+     */
+    void build_rows (const unsigned int first_row,
+		     const unsigned int end_row,
+		     const std::vector<const Elem*> &elems,
+		     const NonlocalGraph &received);
+
+    /**
+     * Moves the full \p sparsity_pattern into \p compressed_pattern.
+     * This is done in two threaded passes: the row lengths are counted
+     * first so that the column array can be allocated exactly once,
+     * then each thread fills (and frees) its own block of rows.
+     * The per-row \p sparsity_pattern is empty afterwards.
+     *
+     * This is only needed when \p sparsity_pattern has been built
+     * row by row, for a user function which modifies it.
+     */
+    void compress ();
   };
 
 #if defined(__GNUC__) && (__GNUC__ < 4) && !defined(__INTEL_COMPILER)
@@ -31,6 +31,7 @@ namespace libMeshEnums {
    */
   enum PointLocatorType {TREE = 0,
 			 LIST,
+			 BVH,
 			 INVALID_LOCATOR};
 }
 
@@ -120,9 +120,9 @@ protected:
   /**
    * The shape functions and their derivatives
    */
-  const std::vector<std::vector<Real> > *phi, *phi_coarse;
-  const std::vector<std::vector<RealGradient> > *dphi, *dphi_coarse;
-  const std::vector<std::vector<RealTensor> > *d2phi, *d2phi_coarse;
+  const ShapeArray<Real> *phi, *phi_coarse;
+  const ShapeArray<RealGradient> *dphi, *dphi_coarse;
+  const ShapeArray<RealTensor> *d2phi, *d2phi_coarse;
 
   /**
    * Mapping jacobians
@@ -0,0 +1,202 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __affine_map_batch_h__
+#define __affine_map_batch_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class QBase;
+
+
+
+/**
+ * This class computes the reference-to-physical maps of a whole block
+ * of elements with affine maps (linear simplices, parallelograms,
+ * parallelepipeds) at once.  The Jacobian of such a map is the same
+ * at every quadrature point, so only the physical locations of the
+ * quadrature points need to be computed per point.
+ *
+ * The results are stored as one contiguous array per component, and
+ * are computed in a few tight sweeps over the whole block instead of
+ * one \p FEMap::compute_map() call per element.  An \p FEMap with a
+ * batch attached copies its data from the batch when it is asked to
+ * map one of the batch's elements at the batch's quadrature points.
+ *
+ * The batch is a snapshot: it must be rebuilt if any of its elements
+ * are moved.
+ */
+class AffineMapBatch
+{
+public:
+
+  /**
+   * Constructor.  Creates an empty batch.
+   */
+  AffineMapBatch ();
+
+  /**
+   * Computes the maps of all those elements in [\p begin, \p end) of
+   * dimension \p dim which have an affine map and the same type and
+   * p level as the first such element, at the points of \p qrule.
+   * Other elements are left out of the batch.  \p qrule is
+   * initialized for that element type and must outlive the batch.
+   */
+  void build (const unsigned int dim,
+              QBase& qrule,
+              std::vector<const Elem*>::const_iterator begin,
+              std::vector<const Elem*>::const_iterator end);
+
+  /**
+   * Empties the batch.
+   */
+  void clear ();
+
+  /**
+   * Returns the number of elements in the batch.
+   */
+  unsigned int n_elem () const
+  { return static_cast<unsigned int>(_elems.size()); }
+
+  /**
+   * Returns the number of quadrature points per element.
+   */
+  unsigned int n_qp () const
+  { return _n_qp; }
+
+  /**
+   * Returns the \p e th element in the batch.
+   */
+  const Elem* elem (const unsigned int e) const
+  { libmesh_assert_less (e, this->n_elem()); return _elems[e]; }
+
+  /**
+   * Returns the index of \p elem in the batch, or \p invalid_uint if
+   * it is not in the batch or the map is wanted at other points than
+   * the batch's: \p qrule must be the rule the batch was built with,
+   * still initialized for the batch's element type and p level.  The
+   * element at index \p hint is checked first, so sequential lookups
+   * are O(1).
+   */
+  unsigned int find (const Elem* elem,
+                     const QBase& qrule,
+                     const unsigned int hint = 0) const;
+
+  /**
+   * Returns the Jacobian of the \p e th element.
+   */
+  Real jac (const unsigned int e) const
+  { return _jac[e]; }
+
+  /**
+   * Returns the Jacobian times the quadrature weight at quadrature
+   * point \p p of the \p e th element.
+   */
+  Real JxW (const unsigned int e, const unsigned int p) const
+  { return _JxW[e*_n_qp + p]; }
+
+  /**
+   * Returns the physical location of quadrature point \p p of the
+   * \p e th element.
+   */
+  Point xyz (const unsigned int e, const unsigned int p) const
+  { return Point(_xyz[0][e*_n_qp + p], _xyz[1][e*_n_qp + p], _xyz[2][e*_n_qp + p]); }
+
+  /**
+   * Returns the derivative of physical coordinate \p d with respect
+   * to reference coordinate \p k on the \p e th element.
+   */
+  Real dxyz_dref (const unsigned int e, const unsigned int k, const unsigned int d) const
+  { return _dxyz_dref[k][d][e]; }
+
+  /**
+   * Returns the derivative of reference coordinate \p k with respect
+   * to physical coordinate \p d on the \p e th element.
+   */
+  Real dref_dxyz (const unsigned int e, const unsigned int k, const unsigned int d) const
+  { return _dref_dxyz[k][d][e]; }
+
+private:
+
+  /**
+   * The dimension of the elements in the batch.
+   */
+  unsigned int _dim;
+
+  /**
+   * The number of quadrature points per element.
+   */
+  unsigned int _n_qp;
+
+  /**
+   * The type and p level of the elements in the batch.
+   */
+  ElemType _type;
+  unsigned int _p_level;
+
+  /**
+   * The quadrature rule the batch was built with.
+   */
+  const QBase* _qrule;
+
+  /**
+   * The elements in the batch.
+   */
+  std::vector<const Elem*> _elems;
+
+  /**
+   * (element, index) pairs sorted by element, for \p find().
+   */
+  std::vector<std::pair<const Elem*, unsigned int> > _sorted_elems;
+
+  /**
+   * The derivatives of the map and of its inverse, indexed
+   * [reference coordinate][physical coordinate][element].
+   */
+  std::vector<Real> _dxyz_dref[3][3];
+  std::vector<Real> _dref_dxyz[3][3];
+
+  /**
+   * The Jacobian of each element.
+   */
+  std::vector<Real> _jac;
+
+  /**
+   * The physical quadrature point locations and Jacobian times
+   * weight values, indexed [element*n_qp + point].
+   */
+  std::vector<Real> _xyz[3];
+  std::vector<Real> _JxW;
+};
+
+} // namespace libMesh
+
+#endif // __affine_map_batch_h__
@@ -22,10 +22,12 @@
 
 // Local includes
 #include "libmesh/fe_base.h"
+#include "libmesh/fe_shape_cache.h"
 #include "libmesh/libmesh.h"
 
 // C++ includes
 #include <cstddef>
+#include <map>
 
 namespace libMesh
 {
@@ -455,6 +457,17 @@ protected:
   virtual void init_shape_functions(const std::vector<Point>& qp,
 				    const Elem* e);
 
+  /**
+   * @returns the shared table of reference shape function values
+   * and derivatives at the points \p qp of our quadrature rule on
+   * elements like \p e, building and caching it if this is the
+   * first time it has been needed.  Only valid when
+   * \p shapes_need_reinit() is false.
+   */
+  const FEShapeTable<OutputShape>* shared_shape_table(const std::vector<Point>& qp,
+                                                      const Elem* e,
+                                                      const unsigned int n_shapes) const;
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
@@ -478,6 +491,14 @@ protected:
   ElemType last_side;
 
   unsigned int last_edge;
+
+  /**
+   * The shared shape tables this object has used so far.  Going back
+   * to an element type seen before finds its table here, without
+   * locking the global \p FEShapeCache.
+   */
+  mutable std::map<typename FEShapeCache<OutputShape>::Key,
+                   const FEShapeTable<OutputShape>*> _shape_tables;
 };
 
 
@@ -42,6 +42,7 @@ namespace libMesh
 
 
 // forward declarations
+class AffineMapBatch;
 template <typename T> class DenseMatrix;
 template <typename T> class DenseVector;
 class BoundaryInfo;
@@ -386,6 +387,13 @@ public:
    */
   virtual void attach_quadrature_rule (QBase* q) = 0;
 
+  /**
+   * Provides the class with precomputed maps for a block of affine
+   * elements; see \p FEMap::attach_affine_map_batch().
+   */
+  void attach_affine_map_batch (const AffineMapBatch* batch)
+  { this->_fe_map->attach_affine_map_batch(batch); }
+
   /**
    * @returns the total number of approximation shape functions
    * for the current element.  Useful during matrix assembly.
@@ -29,6 +29,7 @@
 #include "libmesh/fe_type.h"
 #include "libmesh/auto_ptr.h"
 #include "libmesh/fe_transformation_base.h"
+#include "libmesh/shape_array.h"
 #include "libmesh/tensor_tools.h"
 #include "libmesh/type_n_tensor.h"
 
@@ -52,6 +53,7 @@ class MeshBase;
 template <typename T> class NumericVector;
 class QBase;
 template <typename T> class FETransformationBase;
+template <typename OutputShape> class FEShapeTable;
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
 class NodeConstraints;
@@ -220,6 +222,14 @@ public:
    * on the element.
    */
   const std::vector<std::vector<OutputShape> >& get_phi() const
+  { libmesh_assert(!calculations_started || calculate_phi);
+    calculate_phi = true; return phi.vectors(); }
+
+  /**
+   * Same as \p get_phi(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_phi_array() const
   { libmesh_assert(!calculations_started || calculate_phi);
     calculate_phi = true; return phi; }
 
@@ -228,6 +238,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputGradient> >& get_dphi() const
+  { libmesh_assert(!calculations_started || calculate_dphi);
+    calculate_dphi = calculate_dphiref = true; return dphi.vectors(); }
+
+  /**
+   * Same as \p get_dphi(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputGradient>& get_dphi_array() const
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphi; }
 
@@ -236,6 +254,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_curl_phi() const
+  { libmesh_assert(!calculations_started || calculate_curl_phi);
+    calculate_curl_phi = calculate_dphiref = true; return curl_phi.vectors(); }
+
+  /**
+   * Same as \p get_curl_phi(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_curl_phi_array() const
   { libmesh_assert(!calculations_started || calculate_curl_phi);
     calculate_curl_phi = calculate_dphiref = true; return curl_phi; }
 
@@ -244,6 +270,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputDivergence> >& get_div_phi() const
+  { libmesh_assert(!calculations_started || calculate_div_phi);
+    calculate_div_phi = calculate_dphiref = true; return div_phi.vectors(); }
+
+  /**
+   * Same as \p get_div_phi(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputDivergence>& get_div_phi_array() const
   { libmesh_assert(!calculations_started || calculate_div_phi);
     calculate_div_phi = calculate_dphiref = true; return div_phi; }
 
@@ -252,6 +286,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_dphidx() const
+  { libmesh_assert(!calculations_started || calculate_dphi);
+    calculate_dphi = calculate_dphiref = true; return dphidx.vectors(); }
+
+  /**
+   * Same as \p get_dphidx(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_dphidx_array() const
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphidx; }
 
@@ -260,6 +302,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_dphidy() const
+  { libmesh_assert(!calculations_started || calculate_dphi);
+    calculate_dphi = calculate_dphiref = true; return dphidy.vectors(); }
+
+  /**
+   * Same as \p get_dphidy(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_dphidy_array() const
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphidy; }
 
@@ -268,6 +318,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_dphidz() const
+  { libmesh_assert(!calculations_started || calculate_dphi);
+    calculate_dphi = calculate_dphiref = true; return dphidz.vectors(); }
+
+  /**
+   * Same as \p get_dphidz(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_dphidz_array() const
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphidz; }
 
@@ -276,6 +334,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_dphidxi() const
+  { libmesh_assert(!calculations_started || calculate_dphiref);
+    calculate_dphiref = true; return dphidxi.vectors(); }
+
+  /**
+   * Same as \p get_dphidxi(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_dphidxi_array() const
   { libmesh_assert(!calculations_started || calculate_dphiref);
     calculate_dphiref = true; return dphidxi; }
 
@@ -284,6 +350,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_dphideta() const
+  { libmesh_assert(!calculations_started || calculate_dphiref);
+    calculate_dphiref = true; return dphideta.vectors(); }
+
+  /**
+   * Same as \p get_dphideta(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_dphideta_array() const
   { libmesh_assert(!calculations_started || calculate_dphiref);
     calculate_dphiref = true; return dphideta; }
 
@@ -292,6 +366,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_dphidzeta() const
+  { libmesh_assert(!calculations_started || calculate_dphiref);
+    calculate_dphiref = true; return dphidzeta.vectors(); }
+
+  /**
+   * Same as \p get_dphidzeta(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_dphidzeta_array() const
   { libmesh_assert(!calculations_started || calculate_dphiref);
     calculate_dphiref = true; return dphidzeta; }
 
@@ -302,6 +384,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputTensor> >& get_d2phi() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phi.vectors(); }
+
+  /**
+   * Same as \p get_d2phi(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputTensor>& get_d2phi_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phi; }
 
@@ -310,6 +400,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidx2() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidx2.vectors(); }
+
+  /**
+   * Same as \p get_d2phidx2(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidx2_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidx2; }
 
@@ -318,6 +416,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidxdy() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidxdy.vectors(); }
+
+  /**
+   * Same as \p get_d2phidxdy(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidxdy_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidxdy; }
 
@@ -326,6 +432,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidxdz() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidxdz.vectors(); }
+
+  /**
+   * Same as \p get_d2phidxdz(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidxdz_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidxdz; }
 
@@ -334,6 +448,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidy2() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi =  calculate_dphiref = true; return d2phidy2.vectors(); }
+
+  /**
+   * Same as \p get_d2phidy2(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidy2_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi =  calculate_dphiref = true; return d2phidy2; }
 
@@ -342,6 +464,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidydz() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidydz.vectors(); }
+
+  /**
+   * Same as \p get_d2phidydz(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidydz_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidydz; }
 
@@ -350,6 +480,14 @@ public:
    * points.
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidz2() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidz2.vectors(); }
+
+  /**
+   * Same as \p get_d2phidz2(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidz2_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidz2; }
 
@@ -358,6 +496,14 @@ public:
    * points, in reference coordinates
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidxi2() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidxi2.vectors(); }
+
+  /**
+   * Same as \p get_d2phidxi2(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidxi2_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidxi2; }
 
@@ -366,6 +512,14 @@ public:
    * points, in reference coordinates
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidxideta() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidxideta.vectors(); }
+
+  /**
+   * Same as \p get_d2phidxideta(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidxideta_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidxideta; }
 
@@ -374,6 +528,14 @@ public:
    * points, in reference coordinates
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidxidzeta() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidxidzeta.vectors(); }
+
+  /**
+   * Same as \p get_d2phidxidzeta(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidxidzeta_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidxidzeta; }
 
@@ -382,6 +544,14 @@ public:
    * points, in reference coordinates
    */
   const std::vector<std::vector<OutputShape> >& get_d2phideta2() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phideta2.vectors(); }
+
+  /**
+   * Same as \p get_d2phideta2(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phideta2_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phideta2; }
 
@@ -390,6 +560,14 @@ public:
    * points, in reference coordinates
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidetadzeta() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidetadzeta.vectors(); }
+
+  /**
+   * Same as \p get_d2phidetadzeta(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidetadzeta_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidetadzeta; }
 
@@ -398,11 +576,27 @@ public:
    * points, in reference coordinates
    */
   const std::vector<std::vector<OutputShape> >& get_d2phidzeta2() const
+  { libmesh_assert(!calculations_started || calculate_d2phi);
+    calculate_d2phi = calculate_dphiref = true; return d2phidzeta2.vectors(); }
+
+  /**
+   * Same as \p get_d2phidzeta2(), but returns the contiguous array
+   * instead of a nested vector copy.
+   */
+  const ShapeArray<OutputShape>& get_d2phidzeta2_array() const
   { libmesh_assert(!calculations_started || calculate_d2phi);
     calculate_d2phi = calculate_dphiref = true; return d2phidzeta2; }
 
 #endif //LIBMESH_ENABLE_SECOND_DERIVATIVES
 
+  /**
+   * @returns the shared table of reference shape function values
+   * the current shape functions were copied from, or \p NULL if they
+   * were evaluated for this element alone.
+   */
+  const FEShapeTable<OutputShape>* get_shape_table() const
+  { return _shape_table; }
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
@@ -495,61 +689,75 @@ protected:
    */
   virtual void compute_shape_functions(const Elem* elem, const std::vector<Point>& qp);
 
+  /**
+   * Refreshes the nested vector copies of any shape function arrays
+   * which were requested through the old \p get_phi() style
+   * accessors.  Every \p compute_shape_functions() implementation
+   * should call this once it is done.
+   */
+  void update_shape_vectors();
+
   /**
    * Object that handles computing shape function values, gradients, etc
    * in the physical domain.
    */
   AutoPtr<FETransformationBase<OutputType> > _fe_trans;
 
+  /**
+   * The shared reference shape function table for the current
+   * element type and quadrature rule, if there is one.
+   */
+  const FEShapeTable<OutputShape>* _shape_table;
+
   /**
    * Shape function values.
    */
-  std::vector<std::vector<OutputShape> >   phi;
+  ShapeArray<OutputShape>       phi;
 
   /**
    * Shape function derivative values.
    */
-  std::vector<std::vector<OutputGradient> >  dphi;
+  ShapeArray<OutputGradient>    dphi;
 
   /**
    * Shape function curl values. Only defined for vector types.
    */
-  std::vector<std::vector<OutputShape> > curl_phi;
+  ShapeArray<OutputShape>       curl_phi;
 
   /**
    * Shape function divergence values. Only defined for vector types.
    */
-  std::vector<std::vector<OutputDivergence> > div_phi;
+  ShapeArray<OutputDivergence>  div_phi;
 
   /**
    * Shape function derivatives in the xi direction.
    */
-  std::vector<std::vector<OutputShape> >   dphidxi;
+  ShapeArray<OutputShape>       dphidxi;
 
   /**
    * Shape function derivatives in the eta direction.
    */
-  std::vector<std::vector<OutputShape> >   dphideta;
+  ShapeArray<OutputShape>       dphideta;
 
   /**
    * Shape function derivatives in the zeta direction.
    */
-  std::vector<std::vector<OutputShape> >   dphidzeta;
+  ShapeArray<OutputShape>       dphidzeta;
 
   /**
    * Shape function derivatives in the x direction.
    */
-  std::vector<std::vector<OutputShape> >   dphidx;
+  ShapeArray<OutputShape>       dphidx;
 
   /**
    * Shape function derivatives in the y direction.
    */
-  std::vector<std::vector<OutputShape> >   dphidy;
+  ShapeArray<OutputShape>       dphidy;
 
   /**
    * Shape function derivatives in the z direction.
    */
-  std::vector<std::vector<OutputShape> >   dphidz;
+  ShapeArray<OutputShape>       dphidz;
 
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
@@ -557,67 +765,67 @@ protected:
   /**
    * Shape function second derivative values.
    */
-  std::vector<std::vector<OutputTensor> >  d2phi;
+  ShapeArray<OutputTensor>      d2phi;
 
   /**
    * Shape function second derivatives in the xi direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidxi2;
+  ShapeArray<OutputShape>       d2phidxi2;
 
   /**
    * Shape function second derivatives in the xi-eta direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidxideta;
+  ShapeArray<OutputShape>       d2phidxideta;
 
   /**
    * Shape function second derivatives in the xi-zeta direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidxidzeta;
+  ShapeArray<OutputShape>       d2phidxidzeta;
 
   /**
    * Shape function second derivatives in the eta direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phideta2;
+  ShapeArray<OutputShape>       d2phideta2;
 
   /**
    * Shape function second derivatives in the eta-zeta direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidetadzeta;
+  ShapeArray<OutputShape>       d2phidetadzeta;
 
   /**
    * Shape function second derivatives in the zeta direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidzeta2;
+  ShapeArray<OutputShape>       d2phidzeta2;
 
   /**
    * Shape function second derivatives in the x direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidx2;
+  ShapeArray<OutputShape>       d2phidx2;
 
   /**
    * Shape function second derivatives in the x-y direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidxdy;
+  ShapeArray<OutputShape>       d2phidxdy;
 
   /**
    * Shape function second derivatives in the x-z direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidxdz;
+  ShapeArray<OutputShape>       d2phidxdz;
 
   /**
    * Shape function second derivatives in the y direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidy2;
+  ShapeArray<OutputShape>       d2phidy2;
 
   /**
    * Shape function second derivatives in the y-z direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidydz;
+  ShapeArray<OutputShape>       d2phidydz;
 
   /**
    * Shape function second derivatives in the z direction.
    */
-  std::vector<std::vector<OutputShape> >   d2phidz2;
+  ShapeArray<OutputShape>       d2phidz2;
 
 #endif
 
@@ -686,6 +894,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
 	                                 const FEType& fet) :
   FEAbstract(d,fet),
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
+  _shape_table(NULL),
   phi(),
   dphi(),
   curl_phi(),
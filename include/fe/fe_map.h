@@ -26,12 +26,15 @@
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/shape_array.h"
 
 namespace libMesh
 {
   
 // forward declarations
+class AffineMapBatch;
 class Elem;
+class QBase;
 
   class FEMap
   {
@@ -64,6 +67,16 @@ class Elem;
     virtual void compute_affine_map( const unsigned int dim,
 				     const std::vector<Real>& qw,
 				     const Elem* elem );
+
+    /**
+     * Same as above, but copies the map of the \p e th element of
+     * \p batch, which was precomputed at the points with weights
+     * \p qw.
+     */
+    void compute_affine_map( const unsigned int dim,
+			     const std::vector<Real>& qw,
+			     const AffineMapBatch& batch,
+			     const unsigned int e );
     
     /**
      * Compute the jacobian and some other additional
@@ -73,7 +86,24 @@ class Elem;
     virtual void compute_map( const unsigned int dim,
 			      const std::vector<Real>& qw,
 			      const Elem* elem );
+
+    /**
+     * Takes the map of \p elem from the attached batch, if the batch
+     * holds it at the points of \p qrule, and returns true.  Otherwise
+     * leaves the map alone and returns false.
+     */
+    bool compute_batched_map( const unsigned int dim,
+			      const QBase& qrule,
+			      const Elem* elem );
     
+    /**
+     * Attaches a batch of precomputed affine maps, which
+     * \p compute_batched_map() takes the maps of its elements from.
+     * Pass \p NULL to detach the batch.
+     */
+    void attach_affine_map_batch( const AffineMapBatch* batch )
+    { _affine_batch = batch; _affine_batch_hint = 0; }
+
     /**
      * Same as compute_map, but for a side.  Useful for boundary integration.
      */
@@ -254,30 +284,65 @@ class Elem;
      * @returns the reference to physical map for the side/edge
      */
     const std::vector<std::vector<Real> >& get_psi() const
+    { return psi_map.vectors(); }
+
+    /**
+     * Same as \p get_psi(), but returns the contiguous array
+     * instead of a nested vector copy.
+     */
+    const ShapeArray<Real>& get_psi_array() const
     { return psi_map; }
 
     /**
      * @returns the reference to physical map for the element
      */
     const std::vector<std::vector<Real> >& get_phi_map() const
+    { return phi_map.vectors(); }
+
+    /**
+     * Same as \p get_phi_map(), but returns the contiguous array
+     * instead of a nested vector copy.
+     */
+    const ShapeArray<Real>& get_phi_map_array() const
     { return phi_map; }
 
     /**
      * @returns the reference to physical map derivative
      */
     const std::vector<std::vector<Real> >& get_dphidxi_map() const
+    { return dphidxi_map.vectors(); }
+
+    /**
+     * Same as \p get_dphidxi_map(), but returns the contiguous array
+     * instead of a nested vector copy.
+     */
+    const ShapeArray<Real>& get_dphidxi_map_array() const
     { return dphidxi_map; }
 
     /**
      * @returns the reference to physical map derivative
      */
     const std::vector<std::vector<Real> >& get_dphideta_map() const
+    { return dphideta_map.vectors(); }
+
+    /**
+     * Same as \p get_dphideta_map(), but returns the contiguous array
+     * instead of a nested vector copy.
+     */
+    const ShapeArray<Real>& get_dphideta_map_array() const
     { return dphideta_map; }
 
     /**
      * @returns the reference to physical map derivative
      */
     const std::vector<std::vector<Real> >& get_dphidzeta_map() const
+    { return dphidzeta_map.vectors(); }
+
+    /**
+     * Same as \p get_dphidzeta_map(), but returns the contiguous array
+     * instead of a nested vector copy.
+     */
+    const ShapeArray<Real>& get_dphidzeta_map_array() const
     { return dphidzeta_map; }
 
     /**
@@ -316,101 +381,108 @@ class Elem;
     /**
      * @returns the reference to physical map for the side/edge
      */
-    std::vector<std::vector<Real> >& get_psi()
+    ShapeArray<Real>& get_psi_array()
     { return psi_map; }
 
     /**
      * @returns the reference to physical map derivative for the side/edge
      */
-    std::vector<std::vector<Real> >& get_dpsidxi()
+    ShapeArray<Real>& get_dpsidxi_array()
     { return dpsidxi_map; }
 
     /**
      * @returns the reference to physical map derivative for the side/edge
      */
-    std::vector<std::vector<Real> >& get_dpsideta()
+    ShapeArray<Real>& get_dpsideta_array()
     { return dpsideta_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative for the side/edge
      */
-    std::vector<std::vector<Real> >& get_d2psidxi2()
+    ShapeArray<Real>& get_d2psidxi2_array()
     { return d2psidxi2_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative for the side/edge
      */
-    std::vector<std::vector<Real> >& get_d2psidxideta()
+    ShapeArray<Real>& get_d2psidxideta_array()
     { return d2psidxideta_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative for the side/edge
      */
-    std::vector<std::vector<Real> >& get_d2psideta2()
+    ShapeArray<Real>& get_d2psideta2_array()
     { return d2psideta2_map; }
 
     /**
      * @returns the reference to physical map for the element
      */
-    std::vector<std::vector<Real> >& get_phi_map()
+    ShapeArray<Real>& get_phi_map()
     { return phi_map; }
 
     /**
      * @returns the reference to physical map derivative
      */
-    std::vector<std::vector<Real> >& get_dphidxi_map()
+    ShapeArray<Real>& get_dphidxi_map()
     { return dphidxi_map; }
 
     /**
      * @returns the reference to physical map derivative
      */
-    std::vector<std::vector<Real> >& get_dphideta_map()
+    ShapeArray<Real>& get_dphideta_map()
     { return dphideta_map; }
 
     /**
      * @returns the reference to physical map derivative
      */
-    std::vector<std::vector<Real> >& get_dphidzeta_map()
+    ShapeArray<Real>& get_dphidzeta_map()
     { return dphidzeta_map; }
     
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
     /**
      * @returns the reference to physical map 2nd derivative
      */
-    std::vector<std::vector<Real> >& get_d2phidxi2_map()
+    ShapeArray<Real>& get_d2phidxi2_map()
     { return d2phidxi2_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative
      */
-    std::vector<std::vector<Real> >& get_d2phidxideta_map()
+    ShapeArray<Real>& get_d2phidxideta_map()
     { return d2phidxideta_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative
      */
-    std::vector<std::vector<Real> >& get_d2phidxidzeta_map()
+    ShapeArray<Real>& get_d2phidxidzeta_map()
     { return d2phidxidzeta_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative
      */
-    std::vector<std::vector<Real> >& get_d2phideta2_map()
+    ShapeArray<Real>& get_d2phideta2_map()
     { return d2phideta2_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative
      */
-    std::vector<std::vector<Real> >& get_d2phidetadzeta_map()
+    ShapeArray<Real>& get_d2phidetadzeta_map()
     { return d2phidetadzeta_map; }
 
     /**
      * @returns the reference to physical map 2nd derivative
      */
-    std::vector<std::vector<Real> >& get_d2phidzeta2_map()
+    ShapeArray<Real>& get_d2phidzeta2_map()
     { return d2phidzeta2_map; }
 #endif
 
+    /**
+     * Refreshes the nested vector copies of the mapping shape
+     * functions which have been asked for.  Called once the arrays
+     * above have been filled.
+     */
+    void update_map_vectors();
+
     /* FIXME: PB: This function breaks encapsulation! Needed in FE<>::reinit and 
        InfFE<>::reinit. Not sure yet if the algorithm can be redone to avoid this. */
     /**
@@ -612,94 +684,94 @@ class Elem;
     /**
      * Map for the shape function phi.
      */
-    std::vector<std::vector<Real> >   phi_map;
+    ShapeArray<Real>                  phi_map;
     
     /**
      * Map for the derivative, d(phi)/d(xi).
      */
-    std::vector<std::vector<Real> >   dphidxi_map;
+    ShapeArray<Real>                  dphidxi_map;
     
     /**
      * Map for the derivative, d(phi)/d(eta).
      */
-    std::vector<std::vector<Real> >   dphideta_map;
+    ShapeArray<Real>                  dphideta_map;
     
     /**
      * Map for the derivative, d(phi)/d(zeta).
      */
-    std::vector<std::vector<Real> >   dphidzeta_map;
+    ShapeArray<Real>                  dphidzeta_map;
     
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
     
     /**
      * Map for the second derivative, d^2(phi)/d(xi)^2.
      */
-    std::vector<std::vector<Real> >   d2phidxi2_map;
+    ShapeArray<Real>                  d2phidxi2_map;
     
     /**
      * Map for the second derivative, d^2(phi)/d(xi)d(eta).
      */
-    std::vector<std::vector<Real> >   d2phidxideta_map;
+    ShapeArray<Real>                  d2phidxideta_map;
     
     /**
      * Map for the second derivative, d^2(phi)/d(xi)d(zeta).
      */
-    std::vector<std::vector<Real> >   d2phidxidzeta_map;
+    ShapeArray<Real>                  d2phidxidzeta_map;
     
     /**
      * Map for the second derivative, d^2(phi)/d(eta)^2.
      */
-    std::vector<std::vector<Real> >   d2phideta2_map;
+    ShapeArray<Real>                  d2phideta2_map;
     
     /**
      * Map for the second derivative, d^2(phi)/d(eta)d(zeta).
      */
-    std::vector<std::vector<Real> >   d2phidetadzeta_map;
+    ShapeArray<Real>                  d2phidetadzeta_map;
     
     /**
      * Map for the second derivative, d^2(phi)/d(zeta)^2.
      */
-    std::vector<std::vector<Real> >   d2phidzeta2_map;
+    ShapeArray<Real>                  d2phidzeta2_map;
     
 #endif
     
     /**
      * Map for the side shape functions, psi.
      */
-    std::vector<std::vector<Real> >   psi_map;
+    ShapeArray<Real>                  psi_map;
     
     /**
      * Map for the derivative of the side functions,
      * d(psi)/d(xi).
      */
-    std::vector<std::vector<Real> >   dpsidxi_map;
+    ShapeArray<Real>                  dpsidxi_map;
     
     /**
      * Map for the derivative of the side function,
      * d(psi)/d(eta).
      */
-    std::vector<std::vector<Real> >   dpsideta_map;
+    ShapeArray<Real>                  dpsideta_map;
     
     /**
      * Map for the second derivatives (in xi) of the
      * side shape functions.  Useful for computing
      * the curvature at the quadrature points.
      */
-    std::vector<std::vector<Real> > d2psidxi2_map;
+    ShapeArray<Real>                  d2psidxi2_map;
 
     /**
      * Map for the second (cross) derivatives in xi, eta
      * of the side shape functions.  Useful for
      * computing the curvature at the quadrature points.
      */
-    std::vector<std::vector<Real> > d2psidxideta_map;
+    ShapeArray<Real>                  d2psidxideta_map;
     
     /**
      * Map for the second derivatives (in eta) of the
      * side shape functions.  Useful for computing the
      * curvature at the quadrature points.
      */
-    std::vector<std::vector<Real> > d2psideta2_map;
+    ShapeArray<Real>                  d2psideta2_map;
     
     /**
      * Tangent vectors on boundary at quadrature points.
@@ -728,6 +800,16 @@ class Elem;
      */
     std::vector<Real>                 JxW;
 
+    /**
+     * Precomputed maps for a block of affine elements, if any.
+     */
+    const AffineMapBatch*             _affine_batch;
+
+    /**
+     * The batch index to look for the next element at.
+     */
+    unsigned int                      _affine_batch_hint;
+
 
   private:
     
@@ -780,7 +862,9 @@ class Elem;
      normals(),
      curvatures(),
      jac(),
-     JxW()
+     JxW(),
+     _affine_batch(NULL),
+     _affine_batch_hint(0)
   {}
   
 }
@@ -0,0 +1,155 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __fe_shape_cache_h__
+#define __fe_shape_cache_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_fe_family.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/enum_quadrature_type.h"
+#include "libmesh/point.h"
+#include "libmesh/shape_array.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+
+
+/**
+ * Shape function values and reference-element derivatives at the
+ * points of a quadrature rule.  For most finite element families
+ * these depend only on the element type, its p level and the rule,
+ * not on the physical element, so a single read-only table can be
+ * shared by every FE object on every thread.
+ */
+template <typename OutputShape>
+class FEShapeTable
+{
+public:
+
+  /**
+   * The points the table was evaluated at.
+   */
+  std::vector<Point> qp;
+
+  /**
+   * Shape function values, indexed [i][qp].
+   */
+  ShapeArray<OutputShape> phi;
+
+  /**
+   * Shape function derivatives with respect to the reference
+   * coordinates, indexed [i][qp].
+   */
+  ShapeArray<OutputShape> dphidxi, dphideta, dphidzeta;
+
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+  /**
+   * Shape function second derivatives with respect to the reference
+   * coordinates, indexed [i][qp].  Only filled in if the table was
+   * built with second derivatives.
+   */
+  ShapeArray<OutputShape> d2phidxi2, d2phidxideta,
+    d2phideta2, d2phidxidzeta, d2phidetadzeta, d2phidzeta2;
+#endif
+};
+
+
+
+/**
+ * A global, thread-safe cache of \p FEShapeTable objects.  Tables
+ * are never modified once inserted and live until \p clear() (or
+ * program exit), so callers may keep the returned pointers.
+ *
+ * Lookups take a lock, so an \p FE object remembers the tables it
+ * has been given and only comes here the first time it needs each
+ * one; after that its lookups are lock-free reads of its own copy of
+ * the pointer.
+ */
+template <typename OutputShape>
+class FEShapeCache
+{
+public:
+
+  /**
+   * Everything that determines the contents of a table.
+   */
+  class Key
+  {
+  public:
+    Key (const FEFamily family_in,
+         const Order order_in,
+         const ElemType elem_type_in,
+         const unsigned int p_level_in,
+         const QuadratureType qrule_type_in,
+         const Order qrule_order_in,
+         const bool negative_weights_in,
+         const bool second_derivatives_in) :
+      family(family_in),
+      order(order_in),
+      elem_type(elem_type_in),
+      p_level(p_level_in),
+      qrule_type(qrule_type_in),
+      qrule_order(qrule_order_in),
+      negative_weights(negative_weights_in),
+      second_derivatives(second_derivatives_in)
+    {}
+
+    bool operator< (const Key &other) const;
+
+    FEFamily family;
+    Order order;
+    ElemType elem_type;
+    unsigned int p_level;
+    QuadratureType qrule_type;
+    Order qrule_order;
+    bool negative_weights;
+    bool second_derivatives;
+  };
+
+  /**
+   * Returns the table for \p key, or NULL if none has been inserted.
+   */
+  static const FEShapeTable<OutputShape>* find (const Key &key);
+
+  /**
+   * Inserts \p table under \p key and returns it.  If another thread
+   * got there first, \p table is discarded and the existing table is
+   * returned instead.
+   */
+  static const FEShapeTable<OutputShape>* insert (const Key &key,
+                                                  AutoPtr<FEShapeTable<OutputShape> > table);
+
+  /**
+   * Deletes every table.  Only safe when no FE object exists, since
+   * FE objects keep pointers to the tables they have used.
+   */
+  static void clear ();
+};
+
+} // namespace libMesh
+
+#endif // __fe_shape_cache_h__
@@ -20,6 +20,7 @@
 
 #include "libmesh/fe_base.h"
 #include "libmesh/fe_type.h"
+#include "libmesh/shape_array.h"
 
 namespace libMesh
 {
@@ -58,7 +59,7 @@ namespace libMesh
 			  const Elem* const elem,
 			  const std::vector<Point>& qp,
 			  const FEGenericBase<OutputShape>& fe, 
-			  std::vector<std::vector<OutputShape> >& phi ) const = 0;
+			  ShapeArray<OutputShape>& phi ) const = 0;
  
     /**
      * Evaluates shape function gradients in physical coordinates based on proper
@@ -68,10 +69,10 @@ namespace libMesh
 			   const Elem* const elem,
 			   const std::vector<Point>& qp,
 			   const FEGenericBase<OutputShape>& fe,
-			   std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputGradient> >& dphi,
-			   std::vector<std::vector<OutputShape> >& dphidx,
-			   std::vector<std::vector<OutputShape> >& dphidy, 
-			   std::vector<std::vector<OutputShape> >& dphidz  ) const = 0;
+			   ShapeArray<typename FEGenericBase<OutputShape>::OutputGradient>& dphi,
+			   ShapeArray<OutputShape>& dphidx,
+			   ShapeArray<OutputShape>& dphidy, 
+			   ShapeArray<OutputShape>& dphidz  ) const = 0;
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
     /**
@@ -82,13 +83,13 @@ namespace libMesh
 			    const Elem* const elem,
 			    const std::vector<Point>& qp,
 			    const FEGenericBase<OutputShape>& fe,
-			    std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputTensor> >& d2phi,
-			    std::vector<std::vector<OutputShape> >& d2phidx2,
-			    std::vector<std::vector<OutputShape> >& d2phidxdy, 
-			    std::vector<std::vector<OutputShape> >& d2phidxdz,
-			    std::vector<std::vector<OutputShape> >& d2phidy2,
-			    std::vector<std::vector<OutputShape> >& d2phidydz, 
-			    std::vector<std::vector<OutputShape> >& d2phidz2  ) const = 0;
+			    ShapeArray<typename FEGenericBase<OutputShape>::OutputTensor>& d2phi,
+			    ShapeArray<OutputShape>& d2phidx2,
+			    ShapeArray<OutputShape>& d2phidxdy, 
+			    ShapeArray<OutputShape>& d2phidxdz,
+			    ShapeArray<OutputShape>& d2phidy2,
+			    ShapeArray<OutputShape>& d2phidydz, 
+			    ShapeArray<OutputShape>& d2phidz2  ) const = 0;
 #endif //LIBMESH_ENABLE_SECOND_DERIVATIVES
 
 
@@ -100,7 +101,7 @@ namespace libMesh
 			   const Elem* const elem,
 			   const std::vector<Point>& qp,
 			   const FEGenericBase<OutputShape>& fe,
-			   std::vector<std::vector<OutputShape> >& curl_phi ) const = 0;
+			   ShapeArray<OutputShape>& curl_phi ) const = 0;
 
     /**
      * Evaluates the shape function divergence in physical coordinates based on proper
@@ -110,7 +111,7 @@ namespace libMesh
 			  const Elem* const elem,
 			  const std::vector<Point>& qp,
 			  const FEGenericBase<OutputShape>& fe,
-			  std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputDivergence> >& div_phi ) const = 0;
+			  ShapeArray<typename FEGenericBase<OutputShape>::OutputDivergence>& div_phi ) const = 0;
 
   }; // class FETransformationBase
   
@@ -49,7 +49,7 @@ namespace libMesh
 			  const Elem* const,
 			  const std::vector<Point>&,
 			  const FEGenericBase<OutputShape>&,
-			  std::vector<std::vector<OutputShape> >& ) const;
+			  ShapeArray<OutputShape>& ) const;
     
     /**
      * Evaluates shape function gradients in physical coordinates for H1 conforming 
@@ -59,10 +59,10 @@ namespace libMesh
 			   const Elem* const elem,
 			   const std::vector<Point>& qp,
 			   const FEGenericBase<OutputShape>& fe,
-			   std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputGradient> >& dphi,
-			   std::vector<std::vector<OutputShape> >& dphidx,
-			   std::vector<std::vector<OutputShape> >& dphidy, 
-			   std::vector<std::vector<OutputShape> >& dphidz) const;
+			   ShapeArray<typename FEGenericBase<OutputShape>::OutputGradient>& dphi,
+			   ShapeArray<OutputShape>& dphidx,
+			   ShapeArray<OutputShape>& dphidy, 
+			   ShapeArray<OutputShape>& dphidz) const;
 
 #ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
     /**
@@ -75,13 +75,13 @@ namespace libMesh
 			    const Elem* const elem,
 			    const std::vector<Point>& qp,
 			    const FEGenericBase<OutputShape>& fe,
-			    std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputTensor> >& d2phi,
-			    std::vector<std::vector<OutputShape> >& d2phidx2,
-			    std::vector<std::vector<OutputShape> >& d2phidxdy, 
-			    std::vector<std::vector<OutputShape> >& d2phidxdz,
-			    std::vector<std::vector<OutputShape> >& d2phidy2,
-			    std::vector<std::vector<OutputShape> >& d2phidydz, 
-			    std::vector<std::vector<OutputShape> >& d2phidz2  ) const;
+			    ShapeArray<typename FEGenericBase<OutputShape>::OutputTensor>& d2phi,
+			    ShapeArray<OutputShape>& d2phidx2,
+			    ShapeArray<OutputShape>& d2phidxdy, 
+			    ShapeArray<OutputShape>& d2phidxdz,
+			    ShapeArray<OutputShape>& d2phidy2,
+			    ShapeArray<OutputShape>& d2phidydz, 
+			    ShapeArray<OutputShape>& d2phidz2  ) const;
 #endif //LIBMESH_ENABLE_SECOND_DERIVATIVES
 
     /**
@@ -92,7 +92,7 @@ namespace libMesh
 			   const Elem* const elem,
 			   const std::vector<Point>& qp,
 			   const FEGenericBase<OutputShape>& fe,
-			   std::vector<std::vector<OutputShape> >& curl_phi ) const;
+			   ShapeArray<OutputShape>& curl_phi ) const;
     
     /**
      * Evaluates the shape function divergence in physical coordinates based on H1 conforming
@@ -102,7 +102,7 @@ namespace libMesh
 			  const Elem* const elem,
 			  const std::vector<Point>& qp,
 			  const FEGenericBase<OutputShape>& fe,
-			  std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputDivergence> >& div_phi ) const;
+			  ShapeArray<typename FEGenericBase<OutputShape>::OutputDivergence>& div_phi ) const;
 
   }; // class H1FETransformation
 
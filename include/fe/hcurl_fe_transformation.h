@@ -50,7 +50,7 @@ namespace libMesh
 			  const Elem* const elem,
 			  const std::vector<Point>& qp,
 			  const FEGenericBase<OutputShape>& fe,
-			  std::vector<std::vector<OutputShape> >& phi ) const;
+			  ShapeArray<OutputShape>& phi ) const;
     
     /**
      * Evaluates shape function gradients in physical coordinates for HCurl conforming 
@@ -60,10 +60,10 @@ namespace libMesh
 			   const Elem* const /*elem*/,
 			   const std::vector<Point>& /*qp*/,
 			   const FEGenericBase<OutputShape>& /*fe*/,
-			   std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputGradient> >& /*dphi*/,
-			   std::vector<std::vector<OutputShape> >& /*dphidx*/,
-			   std::vector<std::vector<OutputShape> >& /*dphidy*/, 
-			   std::vector<std::vector<OutputShape> >& /*dphidz*/) const
+			   ShapeArray<typename FEGenericBase<OutputShape>::OutputGradient>& /*dphi*/,
+			   ShapeArray<OutputShape>& /*dphidx*/,
+			   ShapeArray<OutputShape>& /*dphidy*/, 
+			   ShapeArray<OutputShape>& /*dphidz*/) const
     { libmesh_do_once( libMesh::err << "WARNING: Shape function gradients for HCurl elements are not currently "
 		       << "being computed!" << std::endl; ); return; }
 
@@ -76,13 +76,13 @@ namespace libMesh
 			    const Elem* const /*elem*/,
 			    const std::vector<Point>& /*qp*/,
 			    const FEGenericBase<OutputShape>& /*fe*/,
-			    std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputTensor> >& /*d2phi*/,
-			    std::vector<std::vector<OutputShape> >& /*d2phidx2*/,
-			    std::vector<std::vector<OutputShape> >& /*d2phidxdy*/, 
-			    std::vector<std::vector<OutputShape> >& /*d2phidxdz*/,
-			    std::vector<std::vector<OutputShape> >& /*d2phidy2*/,
-			    std::vector<std::vector<OutputShape> >& /*d2phidydz*/, 
-			    std::vector<std::vector<OutputShape> >& /*d2phidz2*/  ) const
+			    ShapeArray<typename FEGenericBase<OutputShape>::OutputTensor>& /*d2phi*/,
+			    ShapeArray<OutputShape>& /*d2phidx2*/,
+			    ShapeArray<OutputShape>& /*d2phidxdy*/, 
+			    ShapeArray<OutputShape>& /*d2phidxdz*/,
+			    ShapeArray<OutputShape>& /*d2phidy2*/,
+			    ShapeArray<OutputShape>& /*d2phidydz*/, 
+			    ShapeArray<OutputShape>& /*d2phidz2*/  ) const
     { libmesh_do_once( libMesh::err << "WARNING: Shape function Hessians for HCurl elements are not currently "
 		       << "being computed!" << std::endl; ); return; }
 #endif //LIBMESH_ENABLE_SECOND_DERIVATIVES
@@ -98,7 +98,7 @@ namespace libMesh
 			   const Elem* const elem,
 			   const std::vector<Point>& qp,
 			   const FEGenericBase<OutputShape>& fe,
-			   std::vector<std::vector<OutputShape> >& curl_phi ) const;
+			   ShapeArray<OutputShape>& curl_phi ) const;
 
     /**
      * Evaluates the shape function divergence in physical coordinates based on HCurl conforming
@@ -108,7 +108,7 @@ namespace libMesh
 			  const Elem* const /*elem*/,
 			  const std::vector<Point>& /*qp*/,
 			  const FEGenericBase<OutputShape>& /*fe*/,
-			  std::vector<std::vector<typename FEGenericBase<OutputShape>::OutputDivergence> >& /*div_phi*/ ) const
+			  ShapeArray<typename FEGenericBase<OutputShape>::OutputDivergence>& /*div_phi*/ ) const
     { libmesh_do_once( libMesh::err << "WARNING: Shape function divergences for HCurl elements are not currently "
 		       << "being computed!" << std::endl; ); return; };
 
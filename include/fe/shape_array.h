@@ -0,0 +1,237 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __shape_array_h__
+#define __shape_array_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+
+
+/**
+ * One row of a \p ShapeArray, i.e. the values of one shape function
+ * at every point.  This is a lightweight view into the array, and
+ * behaves like a fixed-size vector.
+ */
+template <typename T>
+class ShapeArrayRow
+{
+public:
+
+  ShapeArrayRow (T* data_in, const unsigned int size_in) :
+    _data(data_in), _size(size_in) {}
+
+  T& operator[] (const unsigned int p) const
+  { libmesh_assert_less (p, _size); return _data[p]; }
+
+  unsigned int size () const { return _size; }
+
+  bool empty () const { return _size == 0; }
+
+  T* begin () const { return _data; }
+
+  T* end () const { return _data + _size; }
+
+private:
+
+  T* _data;
+  unsigned int _size;
+};
+
+
+
+/**
+ * This class stores a two-dimensional array of shape function data,
+ * indexed [shape function][point], in a single contiguous row-major
+ * block.  Resizing it when the element type changes is one
+ * allocation rather than one per shape function, and a loop over the
+ * points of one shape function streams through memory.
+ *
+ * \p a[i][p], \p a.size() and \p a[i].size() work as they do for a
+ * \p std::vector<std::vector<T> >, so most code indexing the old
+ * nested vectors works unchanged.  Code which needs an actual nested
+ * vector has to ask for one with \p vectors(); only then is a copy
+ * made, and it is kept up to date by \p update_vectors() from then
+ * on.
+ */
+template <typename T>
+class ShapeArray
+{
+public:
+
+  typedef ShapeArrayRow<T> row_type;
+  typedef ShapeArrayRow<const T> const_row_type;
+
+  /**
+   * Constructor.  Creates an empty array.
+   */
+  ShapeArray () :
+    _n_rows(0),
+    _n_cols(0),
+    _vectors_requested(false)
+  {}
+
+  /**
+   * Resizes the array to \p n_rows shape functions at \p n_cols
+   * points.  The contents are kept if the size does not change, and
+   * zeroed otherwise.
+   */
+  void resize (const unsigned int n_rows,
+               const unsigned int n_cols)
+  {
+    if (n_rows == _n_rows && n_cols == _n_cols)
+      return;
+
+    _n_rows = n_rows;
+    _n_cols = n_cols;
+    _data.assign (static_cast<std::size_t>(n_rows)*n_cols, T());
+  }
+
+  /**
+   * Empties the array.
+   */
+  void clear ()
+  {
+    _n_rows = _n_cols = 0;
+    _data.clear();
+  }
+
+  /**
+   * Returns the number of shape functions (rows).
+   */
+  unsigned int size () const { return _n_rows; }
+
+  /**
+   * Returns the number of points (columns).
+   */
+  unsigned int n_points () const { return _n_cols; }
+
+  bool empty () const { return _n_rows == 0; }
+
+  row_type operator[] (const unsigned int i)
+  {
+    libmesh_assert_less (i, _n_rows);
+    return row_type (_data.empty() ? NULL : &_data[static_cast<std::size_t>(i)*_n_cols], _n_cols);
+  }
+
+  const_row_type operator[] (const unsigned int i) const
+  {
+    libmesh_assert_less (i, _n_rows);
+    return const_row_type (_data.empty() ? NULL : &_data[static_cast<std::size_t>(i)*_n_cols], _n_cols);
+  }
+
+  T& operator() (const unsigned int i, const unsigned int p)
+  {
+    libmesh_assert_less (i, _n_rows);
+    libmesh_assert_less (p, _n_cols);
+    return _data[static_cast<std::size_t>(i)*_n_cols + p];
+  }
+
+  const T& operator() (const unsigned int i, const unsigned int p) const
+  {
+    libmesh_assert_less (i, _n_rows);
+    libmesh_assert_less (p, _n_cols);
+    return _data[static_cast<std::size_t>(i)*_n_cols + p];
+  }
+
+  /**
+   * Returns the whole array as one block, indexed [i*n_points()+p].
+   */
+  const std::vector<T>& data () const { return _data; }
+
+  /**
+   * Copies the contents of \p other, without reallocating if the
+   * sizes match.  Any nested vector copy requested from this array
+   * stays requested, and is refreshed.
+   */
+  ShapeArray& operator= (const ShapeArray& other)
+  {
+    _n_rows = other._n_rows;
+    _n_cols = other._n_cols;
+    _data = other._data;
+    this->update_vectors();
+    return *this;
+  }
+
+  ShapeArray (const ShapeArray& other) :
+    _n_rows(other._n_rows),
+    _n_cols(other._n_cols),
+    _data(other._data),
+    _vectors_requested(false)
+  {}
+
+  /**
+   * Returns a copy of the array as nested vectors, for code written
+   * against the old interface.  The copy is made on the first call,
+   * and from then on \p update_vectors() keeps it current, which
+   * costs a copy of the whole array each time.
+   */
+  const std::vector<std::vector<T> >& vectors () const
+  {
+    if (!_vectors_requested)
+      {
+        _vectors_requested = true;
+        this->update_vectors();
+      }
+    return _vectors;
+  }
+
+  /**
+   * Refreshes the nested vector copy, if one has been requested.
+   */
+  void update_vectors () const
+  {
+    if (!_vectors_requested)
+      return;
+
+    _vectors.resize(_n_rows);
+    for (unsigned int i=0; i != _n_rows; ++i)
+      {
+        const typename std::vector<T>::const_iterator row_begin =
+          _data.begin() + static_cast<std::size_t>(i)*_n_cols;
+        _vectors[i].assign(row_begin, row_begin + _n_cols);
+      }
+  }
+
+private:
+
+  unsigned int _n_rows, _n_cols;
+
+  /**
+   * The values, indexed [i*_n_cols + p].
+   */
+  std::vector<T> _data;
+
+  /**
+   * The nested vector copy, and whether anyone has asked for it.
+   */
+  mutable std::vector<std::vector<T> > _vectors;
+  mutable bool _vectors_requested;
+};
+
+} // namespace libMesh
+
+#endif // __shape_array_h__
@@ -50,6 +50,7 @@ namespace libMesh
 class MeshBase;
 class MeshRefinement;
 class Elem;
+class ObjectPool;
 #ifdef LIBMESH_ENABLE_PERIODIC
 class PeriodicBoundaries;
 class PointLocatorBase;
@@ -1109,6 +1110,35 @@ public:
   static AutoPtr<Elem> build (const ElemType type,
 			      Elem* p=NULL);
 
+  /**
+   * Build an element of type \p type, with the memory for it taken
+   * from \p pool.  Meshes use this to keep the children refinement
+   * gives their elements in a pool of their own.
+   */
+  static AutoPtr<Elem> build (const ElemType type,
+			      Elem* p,
+			      ObjectPool& pool);
+
+  /**
+   * Elements are allocated from pools of large blocks, one kind of
+   * block for each size of element, rather than one by one from the
+   * heap.  Elements built with plain \p new come from a pool shared
+   * by the whole program; \p new(pool) takes them from \p pool.
+   * Either way \p delete returns an element to the pool it came
+   * from.
+   */
+  static void* operator new (std::size_t size);
+  static void* operator new (std::size_t size, ObjectPool& pool);
+  static void operator delete (void* p);
+  static void operator delete (void* p, ObjectPool& pool);
+
+  /**
+   * Returns the blocks of the shared element pool with no elements
+   * left to the heap.  The pools of meshes are released when the
+   * meshes are cleared.
+   */
+  static void release_memory ();
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -27,6 +27,7 @@
 #include "libmesh/auto_ptr.h"
 
 // C++ includes
+#include <cstddef>
 #include <iostream>
 #include <vector>
 
@@ -38,6 +39,7 @@ namespace libMesh
 class Node;
 class MeshBase;
 class MeshRefinement;
+class ObjectPool;
 
 
 /**
@@ -111,6 +113,25 @@ public:
 			      const Real z,
 			      const unsigned int id);
 
+  /**
+   * Nodes are allocated from pools of large blocks rather than one by
+   * one from the heap.  Nodes built with plain \p new come from a
+   * pool shared by the whole program; \p new(pool) takes them from
+   * \p pool, as meshes do for the nodes they add.  Either way
+   * \p delete returns a node to the pool it came from.
+   */
+  static void* operator new (std::size_t size);
+  static void* operator new (std::size_t size, ObjectPool& pool);
+  static void operator delete (void* p);
+  static void operator delete (void* p, ObjectPool& pool);
+
+  /**
+   * Returns the blocks of the shared node pool to the heap, if there
+   * are no nodes left in it.  The pools of meshes are released when
+   * the meshes are cleared.
+   */
+  static void release_memory ();
+
   /**
    * @returns \p true if the node is active.  An active node is
    * defined as one for which \p id() is not \p Node::invalid_id.
@@ -24,6 +24,8 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h"
 
+#include LIBMESH_INCLUDE_UNORDERED_MULTIMAP
+
 // C++ includes
 #include <cstddef>
 #include <map>
@@ -377,20 +379,27 @@ public:
    */
   const MeshBase& _mesh;
 
+  /**
+   * Hashed multimaps from nodes and from elements to their boundary
+   * data, so that a lookup does not have to search a tree.
+   */
+  typedef LIBMESH_BEST_UNORDERED_MULTIMAP<const Node*,
+                                          boundary_id_type> node_id_map_type;
+  typedef LIBMESH_BEST_UNORDERED_MULTIMAP<const Elem*,
+                                          std::pair<unsigned short int, boundary_id_type> >
+                                                            side_id_map_type;
+
   /**
    * Data structure that maps nodes in the mesh
    * to boundary ids.
    */
-  std::multimap<const Node*,
-                boundary_id_type> _boundary_node_id;
+  node_id_map_type _boundary_node_id;
 
   /**
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem*,
-                std::pair<unsigned short int, boundary_id_type> >
-                                             _boundary_side_id;
+  side_id_map_type _boundary_side_id;
 
   /**
    * A collection of user-specified boundary ids for *both* sides and nodes.
@@ -493,33 +502,6 @@ public:
 
 };
 
-
-
-
-
-
-// ------------------------------------------------------------
-// BoundaryInfo inline methods
-inline
-void BoundaryInfo::remove (const Node* node)
-{
-  libmesh_assert(node);
-
-  // Erase everything associated with node
-  _boundary_node_id.erase (node);
-}
-
-
-
-inline
-void BoundaryInfo::remove (const Elem* elem)
-{
-  libmesh_assert(elem);
-
-  // Erase everything associated with elem
-  _boundary_side_id.erase (elem);
-}
-
 } // namespace libMesh
 
 #endif
@@ -29,6 +29,7 @@
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/libmesh_common.h"
 #include "libmesh/multi_predicates.h"
+#include "libmesh/object_pool.h"
 #include "libmesh/partitioner.h" // AutoPtr needs a real declaration
 #include "libmesh/point_locator_base.h"
 #include "libmesh/variant_filter_iterator.h"
@@ -45,6 +46,7 @@ class Elem;
 class Node;
 class Point;
 class MeshData;
+class NodeCoordinates;
 
 
 
@@ -103,6 +105,11 @@ public:
    */
   virtual AutoPtr<Partitioner> &partitioner() { return _partitioner; }
 
+  /**
+   * The pool refinement builds the children of the elements from.
+   */
+  ObjectPool& elem_pool () { return _elem_pool; }
+
   /**
    * Deletes all the data that are currently stored.
    */
@@ -471,8 +478,13 @@ public:
    *
    * The argument to skip renumbering is now deprecated - to prevent a
    * mesh from being renumbered, set allow_renumbering(false).
+   *
+   * If \p skip_find_neighbors is true the neighbor links are assumed
+   * to be valid already, as they are after \p MeshRefinement has
+   * updated them itself, and step 1 is skipped.
    */
-  void prepare_for_use (const bool skip_renumber_nodes_and_elements=false);
+  void prepare_for_use (const bool skip_renumber_nodes_and_elements=false,
+                        const bool skip_find_neighbors=false);
 
   /**
    * Call the default partitioner (currently \p metis_partition()).
@@ -651,6 +663,37 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * If true is passed in then the mesh will keep a contiguous,
+   * structure-of-arrays copy of its node coordinates, which geometric
+   * sweeps such as \p MeshTools::bounding_box() use instead of
+   * visiting every \p Node.  This trades memory, LIBMESH_DIM Reals
+   * and a processor id per node, for speed when the same mesh
+   * geometry is swept repeatedly.  It is off by default.
+   *
+   * The copy is built lazily and dropped whenever nodes are added,
+   * deleted, renumbered or repartitioned, and by the library's own
+   * node movers.  If you move nodes yourself, call
+   * \p clear_node_coordinates() afterwards.  Debug builds check that
+   * the copy is current whenever it is used.
+   */
+  void cache_node_coordinates(bool cache);
+  bool cache_node_coordinates() const { return _cache_node_coordinates; }
+
+  /**
+   * Returns the contiguous copy of the node coordinates, building it
+   * first if necessary.  Only valid when \p cache_node_coordinates()
+   * is true.  Like \p point_locator(), this should not be called from
+   * threaded code unless the copy has already been built.
+   */
+  const NodeCoordinates& node_coordinates () const;
+
+  /**
+   * Releases the contiguous copy of the node coordinates, so that
+   * it will be rebuilt on next use.
+   */
+  void clear_node_coordinates ();
+
   /**
    * Verify id and processor_id consistency of our elements and
    * nodes containers.
@@ -842,6 +885,18 @@ protected:
    */
   mutable AutoPtr<PointLocatorBase> _point_locator;
 
+  /**
+   * A contiguous copy of the node coordinates, built on demand when
+   * \p _cache_node_coordinates is true.  Mutable for the same reason
+   * as \p _point_locator.
+   */
+  mutable AutoPtr<NodeCoordinates> _node_coordinates;
+
+  /**
+   * If this is true then node_coordinates() may be used.
+   */
+  bool _cache_node_coordinates;
+
   /**
    * A partitioner to use at each prepare_for_use().
    *
@@ -869,6 +924,15 @@ protected:
    */
   std::map<subdomain_id_type, std::string> _block_id_to_name;
 
+  /**
+   * The pools which hold the nodes added by \p add_point() and the
+   * children refinement builds for the elements.  Each size of
+   * element gets its own blocks.  Derived classes release the pools
+   * in bulk when they are cleared.
+   */
+  ObjectPool _node_pool;
+  ObjectPool _elem_pool;
+
   /**
    * The partitioner class is a friend so that it can set
    * the number of partitions.
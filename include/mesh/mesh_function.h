@@ -40,6 +40,7 @@ template <typename T> class DenseVector;
 class EquationSystems;
 template <typename T> class NumericVector;
 class DofMap;
+class Elem;
 class PointLocatorBase;
 
 
@@ -166,6 +167,38 @@ public:
 		const Real time,
 		std::vector<Tensor>& output);
 
+  /**
+   * Computes values at each of the coordinates \p points and for time
+   * \p time.  \p output[i] is set as \p operator() would set it for
+   * \p points[i].  The points are grouped by the element containing
+   * them, so each element is mapped and its degrees of freedom are
+   * gathered only once, and the groups are evaluated across threads.
+   * This does not change the function, so it may be called
+   * concurrently.
+   */
+  void operator() (const std::vector<Point>& points,
+		   const Real time,
+		   std::vector<DenseVector<Number> >& output) const;
+
+  /**
+   * Computes gradients at each of the coordinates \p points and for
+   * time \p time, in the same way.  \p output[i] is empty for a
+   * point that is not in the mesh.
+   */
+  void gradient (const std::vector<Point>& points,
+		 const Real time,
+		 std::vector<std::vector<Gradient> >& output) const;
+
+  /**
+   * Computes values, gradients, or both at each of the coordinates
+   * \p points and for time \p time in a single pass.  Either output
+   * may be \p NULL if it is not wanted.
+   */
+  void evaluate (const std::vector<Point>& points,
+		 const Real time,
+		 std::vector<DenseVector<Number> >* values,
+		 std::vector<std::vector<Gradient> >* gradients) const;
+
   /**
    * Returns the current \p PointLocator object, for you might want to
    * use it elsewhere.  The \p MeshFunction object must be initialized
@@ -204,6 +237,13 @@ public:
 
 protected:
 
+  /**
+   * Returns \p element, or if \p element belongs to another
+   * processor and our vector is not serial, an element on this
+   * processor which also contains \p p, or \p NULL if there is none.
+   */
+  const Elem* find_local_element (const Elem* element,
+				  const Point& p) const;
 
   /**
    * The equation systems handler, from which
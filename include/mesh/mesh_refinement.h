@@ -271,6 +271,10 @@ public:
    * The processor_id is assigned to the new node (only if no existing
    * node is found.  The tolerance \p tol tells the method how far away
    * from p to search for existing nodes.
+   *
+   * Only the nodes added by earlier calls are searched.  Refinement
+   * does not use this function; it is kept for code which refines
+   * elements itself with \p Elem::refine().
    */
   Node* add_point (const Point& p,
                    const unsigned int processor_id,
@@ -392,6 +396,17 @@ public:
    */
   unsigned char& node_level_mismatch_limit();
 
+  /**
+   * If \p skip_find_neighbors is true, refinement and coarsening of
+   * a serial mesh update the neighbor links of the families they
+   * change, and the mesh is then prepared for use without
+   * \p find_neighbors().  If it is false, or the mesh is distributed,
+   * all the neighbor links are found again after every change.
+   *
+   * \p skip_find_neighbors is true by default.
+   */
+  bool& skip_find_neighbors();
+
 private:
 
   /**
@@ -420,6 +435,13 @@ private:
    */
   bool _refine_elements ();
 
+  /**
+   * @returns \p true if refinement and coarsening update the neighbor
+   * links themselves: when \p skip_find_neighbors() is set and the
+   * mesh is serial.
+   */
+  bool _update_neighbors_locally () const;
+
 
 
   //------------------------------------------------------
@@ -606,7 +628,11 @@ private:
                                  Elem* neighbor);
 
   /**
-   * Data structure that holds the new nodes information.
+   * The nodes added by \p add_point(), which it searches by location.
+   * Refinement never fills this map: the nodes of new children are
+   * matched up by the ids of the parent nodes which define them, for
+   * any number of threads.  Coarsening a non-serial mesh fills it
+   * with every node for \p make_nodes_parallel_consistent().
    */
   LocationMap<Node> _new_nodes_map;
 
@@ -643,6 +669,8 @@ private:
   unsigned char _face_level_mismatch_limit, _edge_level_mismatch_limit,
 	        _node_level_mismatch_limit;
 
+  bool _skip_find_neighbors;
+
 #ifdef LIBMESH_ENABLE_PERIODIC
   PeriodicBoundaries * _periodic_boundaries;
 #endif
@@ -710,6 +738,11 @@ inline unsigned char& MeshRefinement::node_level_mismatch_limit()
   return _node_level_mismatch_limit;
 }
 
+inline bool& MeshRefinement::skip_find_neighbors()
+{
+  return _skip_find_neighbors;
+}
+
 
 } // namespace libMesh
 
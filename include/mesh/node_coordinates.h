@@ -0,0 +1,148 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __node_coordinates_h__
+#define __node_coordinates_h__
+
+// Local Includes -----------------------------------
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dof_object.h" // for processor_id_type
+#include "libmesh/mesh_tools.h"
+#include "libmesh/point.h"
+
+// C++ Includes   -----------------------------------
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+
+
+
+/**
+ * This class holds the coordinates of every node a mesh stores on
+ * this processor in structure-of-arrays form: one contiguous array
+ * per spatial component, plus the processor id of each node.
+ * Entries are in the order of the mesh's node iterators.  That is
+ * LIBMESH_DIM Reals and a processor id per node on top of the
+ * \p Node objects themselves, which is why the mesh only keeps one
+ * on request.
+ *
+ * Sweeps over node geometry (bounding boxes, space filling curve
+ * keys) can then stream through a few flat arrays instead of
+ * visiting each separately allocated \p Node.
+ *
+ * The \p Node objects remain the authoritative copy of the
+ * coordinates; this is a snapshot, which is only valid until nodes
+ * are added, removed, renumbered, repartitioned or moved.  Use it
+ * through \p MeshBase::node_coordinates(), which the mesh drops on
+ * each of those changes and rebuilds on the next use.
+ */
+
+// ------------------------------------------------------------
+// NodeCoordinates class definition
+class NodeCoordinates
+{
+public:
+
+  /**
+   * Constructor.  Creates an empty snapshot.
+   */
+  NodeCoordinates ();
+
+  /**
+   * Copies the coordinates of every node in \p mesh.
+   */
+  void build (const MeshBase& mesh);
+
+  /**
+   * Releases all memory.
+   */
+  void clear ();
+
+  /**
+   * Returns the number of nodes in the snapshot.
+   */
+  unsigned int size () const
+  { return static_cast<unsigned int>(_processor_id.size()); }
+
+  bool empty () const
+  { return _processor_id.empty(); }
+
+  /**
+   * Returns the \p d component of the coordinates of the \p i th node.
+   */
+  Real operator() (const unsigned int i, const unsigned int d) const
+  {
+    libmesh_assert_less (d, LIBMESH_DIM);
+    libmesh_assert_less (i, this->size());
+    return _coords[d][i];
+  }
+
+  /**
+   * Returns the contiguous array of \p d components of every node.
+   */
+  const std::vector<Real>& component (const unsigned int d) const
+  {
+    libmesh_assert_less (d, LIBMESH_DIM);
+    return _coords[d];
+  }
+
+  /**
+   * Returns the location of the \p i th node.
+   */
+  Point point (const unsigned int i) const;
+
+  /**
+   * Returns the processor id of the \p i th node.
+   */
+  processor_id_type processor_id (const unsigned int i) const
+  { return _processor_id[i]; }
+
+  /**
+   * Returns the bounding box of all the nodes in the snapshot.
+   * This is a local operation; no communication is done.
+   */
+  MeshTools::BoundingBox bounding_box () const;
+
+  /**
+   * Returns true if the snapshot still holds the current coordinates
+   * and processor ids of every node in \p mesh, in order.  This
+   * visits every node, so it is only meant for debugging checks.
+   */
+  bool matches (const MeshBase& mesh) const;
+
+private:
+
+  /**
+   * The x, y and z coordinates of each node.
+   */
+  std::vector<Real> _coords[LIBMESH_DIM];
+
+  /**
+   * The processor id of each node.
+   */
+  std::vector<processor_id_type> _processor_id;
+};
+
+} // namespace libMesh
+
+#endif // __node_coordinates_h__
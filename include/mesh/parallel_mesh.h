@@ -21,7 +21,7 @@
 #define __parallel_mesh_h__
 
 // Local Includes -----------------------------------
-#include "libmesh/mapvector.h"
+#include "libmesh/vectormap.h"
 #include "libmesh/unstructured_mesh.h"
 
 // C++ Includes   -----------------------------------
@@ -112,7 +112,7 @@ class ParallelMesh : public UnstructuredMesh
    * Calls libmesh_assert() on each possible failure in that container.
    */
   template <typename T>
-  void libmesh_assert_valid_parallel_object_ids(const mapvector<T*>&) const;
+  void libmesh_assert_valid_parallel_object_ids(const vectormap<T*>&) const;
 
   /**
    * Verify id and processor_id consistency of our elements and
@@ -134,7 +134,7 @@ class ParallelMesh : public UnstructuredMesh
    * container.
    */
   template <typename T>
-  unsigned int renumber_dof_objects (mapvector<T*>&);
+  unsigned int renumber_dof_objects (vectormap<T*>&);
 
   /**
    * Remove NULL elements from arrays
@@ -389,12 +389,12 @@ protected:
   /**
    * The verices (spatial coordinates) of the mesh.
    */
-  mapvector<Node*> _nodes;
+  vectormap<Node*> _nodes;
 
   /**
    * The elements in the mesh.
    */
-  mapvector<Elem*> _elements;
+  vectormap<Elem*> _elements;
 
   /**
    * A boolean remembering whether we're serialized or not
@@ -427,15 +427,15 @@ private:
    * Typedefs for the container implementation.  In this case,
    * it's just a std::vector<Elem*>.
    */
-  typedef mapvector<Elem*>::veclike_iterator             elem_iterator_imp;
-  typedef mapvector<Elem*>::const_veclike_iterator const_elem_iterator_imp;
+  typedef vectormap<Elem*>::veclike_iterator             elem_iterator_imp;
+  typedef vectormap<Elem*>::const_veclike_iterator const_elem_iterator_imp;
 
   /**
    * Typedefs for the container implementation.  In this case,
    * it's just a std::vector<Node*>.
    */
-  typedef mapvector<Node*>::veclike_iterator             node_iterator_imp;
-  typedef mapvector<Node*>::const_veclike_iterator const_node_iterator_imp;
+  typedef vectormap<Node*>::veclike_iterator             node_iterator_imp;
+  typedef vectormap<Node*>::const_veclike_iterator const_node_iterator_imp;
 };
 
 
@@ -82,7 +82,14 @@ public:
 
   /**
    * Overloads writing equation systems, this is done because when overloading
-   * write_nodal_data there would be no way to export cell centered data
+   * write_nodal_data there would be no way to export cell centered data.
+   *
+   * Writes a VTK parallel unstructured grid: every processor writes
+   * its active local elements and their nodal solution values to its
+   * own piece, \p fname without the ".pvtu" plus "_<rank>.vtu", and
+   * processor 0 writes the \p fname file listing the pieces.  No
+   * global solution vector is built and the mesh is not serialized.
+   * The files are written directly, so this does not need VTK.
    */
 
   virtual void write_equation_systems(const std::string& fname,
@@ -120,11 +127,6 @@ private:
   vtkCellArray* cells_to_vtk(const MeshBase& mesh, std::vector<int>& types);
 //  , vtkUnstructuredGrid*& grid);
 
-  /**
-   * write the solution to a vtkUnstructuredGrid
-   */
-  void solution_to_vtk(const EquationSystems& es,vtkUnstructuredGrid*& grid);
-
   /**
    * write the system vectors to vtk
    */
@@ -149,7 +151,7 @@ private:
 inline
 VTKIO::VTKIO (MeshBase& mesh, MeshData* mesh_data) :
 	MeshInput<MeshBase> (mesh),
-	MeshOutput<MeshBase>(mesh),
+	MeshOutput<MeshBase>(mesh, /* is_parallel_format = */ true),
 	_mesh_data(mesh_data)
 {
   _vtk_grid = NULL;
@@ -160,7 +162,7 @@ VTKIO::VTKIO (MeshBase& mesh, MeshData* mesh_data) :
 
 inline
 VTKIO::VTKIO (const MeshBase& mesh, MeshData* mesh_data) :
-	MeshOutput<MeshBase>(mesh),
+	MeshOutput<MeshBase>(mesh, /* is_parallel_format = */ true),
 	_mesh_data(mesh_data)
 {
   _vtk_grid = NULL;
@@ -122,8 +122,12 @@ class XdrIO : public MeshInput<MeshBase>,
 
      "libMesh-0.7.0+"
      "libMesh-0.7.0+ parallel"
+     "libMesh-0.7.0+ parallel indexed"
 
      \endverbatim
+     A "parallel indexed" file only holds the header and the number of
+     processor files; each processor file holds the nodes, elements
+     and boundary conditions one processor owned.
      If "libMesh" is not detected in the version string the
      \p LegacyXdrIO class will be used to read older
      (pre version 0.7.0) mesh files.
@@ -176,6 +180,12 @@ class XdrIO : public MeshInput<MeshBase>,
    */
   void write_serialized_bcs (Xdr &io, const unsigned int n_bcs) const;
 
+  /**
+   * Write the nodes, elements and boundary conditions this processor
+   * owns to its own processor file of \p name
+   */
+  void write_local_piece (const std::string &name) const;
+
 
 
   //---------------------------------------------------------------------------
@@ -195,6 +205,13 @@ class XdrIO : public MeshInput<MeshBase>,
    */
   void read_serialized_bcs (Xdr &io);
 
+  /**
+   * Read the \p n_files processor files of \p name, each processor
+   * reading every n_processors()-th file, and give every processor
+   * the whole mesh
+   */
+  void read_pieces (const std::string &name, const unsigned int n_files);
+
   //-------------------------------------------------------------------------
   /**
    * Pack an element into a transfer buffer for parallel communication.
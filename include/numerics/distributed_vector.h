@@ -413,6 +413,30 @@ public:
   void localize (NumericVector<T>& v_local,
 		 const std::vector<unsigned int>& send_list) const;
 
+  /**
+   * Creates a local vector \p v_local containing only information
+   * relevant to this processor, as described by \p plan.  Only the
+   * entries in the plan are exchanged, and the message buffers are
+   * kept from one call to the next.  Entries of \p v_local which are
+   * neither local nor in the plan are left as they were.
+   */
+  void localize (NumericVector<T>& v_local,
+		 const ScatterPlan& plan) const;
+
+  /**
+   * Copies the local entries into \p v_local and starts the exchange
+   * of the entries in \p plan.
+   */
+  void localize_begin (NumericVector<T>& v_local,
+		       const ScatterPlan& plan) const;
+
+  /**
+   * Waits for the exchange started by \p localize_begin() and copies
+   * the entries received into \p v_local.
+   */
+  void localize_end (NumericVector<T>& v_local,
+		     const ScatterPlan& plan) const;
+
   /**
    * Updates a local vector with selected values from neighboring
    * processors, as defined by \p send_list.
@@ -469,6 +493,22 @@ private:
    * The last component (+1) stored locally
    */
   unsigned int _last_local_index;
+
+  /**
+   * The messages of a \p localize_begin() which has not been
+   * ended yet, one per processor in the plan.  The buffers keep
+   * their memory for the next localization.
+   */
+  mutable std::vector<Parallel::Request> _localize_requests;
+  mutable std::vector<std::vector<T> > _localize_send_buffers;
+  mutable std::vector<std::vector<T> > _localize_recv_buffers;
+
+  /**
+   * The tag of those messages.  It is held until \p localize_end(),
+   * so that no other exchange can be given the same tag while they
+   * are in flight.
+   */
+  mutable Parallel::MessageTag _localize_tag;
 };
 
 
@@ -672,6 +712,9 @@ void DistributedVector<T>::clear ()
     _first_local_index =
     _last_local_index = 0;
 
+  libmesh_assert (_localize_requests.empty());
+  _localize_send_buffers.clear();
+  _localize_recv_buffers.clear();
 
   this->_is_closed = this->_is_initialized = false;
 }
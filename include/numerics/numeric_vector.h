@@ -43,6 +43,7 @@ template <typename T> class DenseVector;
 template <typename T> class DenseSubVector;
 template <typename T> class SparseMatrix;
 template <typename T> class ShellMatrix;
+class ScatterPlan;
 
 
 /**
@@ -507,6 +508,33 @@ public:
   virtual void localize (NumericVector<T>& v_local,
 			 const std::vector<unsigned int>& send_list) const = 0;
 
+  /**
+   * Same, but the entries to fetch and the communication needed to
+   * fetch them are given by a \p plan built for the \p send_list, and
+   * for the partitioning of this vector.  The default implementation
+   * simply calls the \p send_list version; implementations which do
+   * their own communication reuse the plan instead of working out
+   * who needs what all over again.
+   */
+  virtual void localize (NumericVector<T>& v_local,
+			 const ScatterPlan& plan) const;
+
+  /**
+   * Splits \p localize(v_local, plan) in two, so that local work can
+   * be done while the entries from other processors are on their
+   * way.  After \p localize_begin() the local entries of \p v_local
+   * are up to date, and after \p localize_end() the others are too.
+   * The vector may be modified in between, but \p v_local may not.
+   *
+   * Every processor must begin and end its localizations in the same
+   * order.  By default all the work is done by \p localize_begin().
+   */
+  virtual void localize_begin (NumericVector<T>& v_local,
+			       const ScatterPlan& plan) const;
+
+  virtual void localize_end (NumericVector<T>& v_local,
+			     const ScatterPlan& plan) const;
+
   /**
    * Updates a local vector with selected values from neighboring
    * processors, as defined by \p send_list.
@@ -0,0 +1,150 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __scatter_plan_h__
+#define __scatter_plan_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class describes the communication needed to localize a
+ * parallel vector onto the entries of a send list: which entries
+ * each processor has to receive, and from whom, and which of its own
+ * entries it has to send, and to whom.  Working this out takes a
+ * round of communication, so a plan is built once for a send list
+ * and reused for every localization until the send list or the
+ * partitioning of the vector changes.
+ *
+ * The \p DofMap keeps a plan for its send list, and
+ * \p NumericVector::localize() accepts one in place of the send list.
+ */
+
+// ------------------------------------------------------------
+// ScatterPlan class definition
+class ScatterPlan
+{
+public:
+
+  /**
+   * Constructor.  Creates an empty plan.
+   */
+  ScatterPlan ();
+
+  /**
+   * Builds the plan for the entries in \p send_list of a vector
+   * whose entries on processor \p p end at \p end_index[p] and begin
+   * where those of processor \p p-1 end.  Entries of \p send_list
+   * which are local to this processor are ignored.
+   *
+   * This function is collective and therefore must be called by all
+   * processors.
+   */
+  void build (const std::vector<unsigned int>& send_list,
+              const std::vector<unsigned int>& end_index);
+
+  /**
+   * Empties the plan.
+   */
+  void clear ();
+
+  /**
+   * @returns true if the plan has been built.
+   */
+  bool initialized () const { return _initialized; }
+
+  /**
+   * @returns the size of the vectors the plan was built for.
+   */
+  unsigned int size () const { return _size; }
+
+  /**
+   * @returns the first entry of the vectors which is local to this
+   * processor.
+   */
+  unsigned int first_local_index () const { return _first_local_index; }
+
+  /**
+   * @returns the last entry (+1) of the vectors which is local to
+   * this processor.
+   */
+  unsigned int last_local_index () const { return _last_local_index; }
+
+  /**
+   * @returns the entries of the send list which belong to other
+   * processors, grouped by the processor they belong to.
+   */
+  const std::vector<unsigned int>& ghost_indices () const
+  { return _ghost_indices; }
+
+  /**
+   * @returns the processors this processor receives entries from.
+   * The entries from the ith one are those in \p ghost_indices()
+   * between \p recv_offsets()[i] and \p recv_offsets()[i+1].
+   */
+  const std::vector<unsigned int>& recv_processor_ids () const
+  { return _recv_processor_ids; }
+
+  const std::vector<unsigned int>& recv_offsets () const
+  { return _recv_offsets; }
+
+  /**
+   * @returns the processors this processor sends entries to.  The
+   * entries for the ith one are those in \p send_indices() between
+   * \p send_offsets()[i] and \p send_offsets()[i+1].
+   */
+  const std::vector<unsigned int>& send_processor_ids () const
+  { return _send_processor_ids; }
+
+  const std::vector<unsigned int>& send_offsets () const
+  { return _send_offsets; }
+
+  /**
+   * @returns the entries this processor sends, numbered from its
+   * first local entry.
+   */
+  const std::vector<unsigned int>& send_indices () const
+  { return _send_indices; }
+
+private:
+
+  bool _initialized;
+
+  unsigned int _size;
+  unsigned int _first_local_index;
+  unsigned int _last_local_index;
+
+  std::vector<unsigned int> _ghost_indices;
+  std::vector<unsigned int> _recv_processor_ids;
+  std::vector<unsigned int> _recv_offsets;
+
+  std::vector<unsigned int> _send_processor_ids;
+  std::vector<unsigned int> _send_offsets;
+  std::vector<unsigned int> _send_indices;
+};
+
+} // namespace libMesh
+
+#endif // #define __scatter_plan_h__
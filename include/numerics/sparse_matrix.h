@@ -39,7 +39,7 @@ namespace libMesh
 template <typename T> class SparseMatrix;
 template <typename T> class DenseMatrix;
 class DofMap;
-namespace SparsityPattern { class Graph; }
+namespace SparsityPattern { class Graph; class CompressedGraph; }
 template <typename T> class NumericVector;
 
 // This template helper function must be declared before it
@@ -123,6 +123,16 @@ public:
    */
   virtual void update_sparsity_pattern (const SparsityPattern::Graph &) {}
 
+  /**
+   * Updates the matrix sparsity pattern from a compressed (CSR)
+   * graph, which is what the \p DofMap hands to matrices that need
+   * the full sparsity pattern.  By default the graph is copied row by
+   * row and passed on to \p update_sparsity_pattern(const Graph&),
+   * so only formats which can use the compressed graph directly need
+   * to overload this method.
+   */
+  virtual void update_sparsity_pattern (const SparsityPattern::CompressedGraph &);
+
   /**
    * Initialize a Sparse matrix that is of global
    * dimension \f$ m \times  n \f$ with local dimensions
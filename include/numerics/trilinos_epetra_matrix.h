@@ -103,6 +103,12 @@ public:
    */
   void update_sparsity_pattern (const SparsityPattern::Graph &);
 
+  /**
+   * Updates the matrix sparsity pattern from a compressed graph,
+   * whose row offsets and column indices can be used as-is.
+   */
+  void update_sparsity_pattern (const SparsityPattern::CompressedGraph &);
+
   /**
    * Initialize a Petsc matrix that is of global
    * dimension \f$ m \times  n \f$ with local dimensions
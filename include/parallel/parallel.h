@@ -169,6 +169,12 @@ namespace Parallel
      */
     MessageTag(const MessageTag& other);
 
+    /**
+     * Assignment operator.  Helps Communicator do reference counting
+     * on unique tags
+     */
+    MessageTag& operator= (const MessageTag& other);
+
     /**
      * Destructor.  Helps Communicator do reference counting on unique
      * tags
@@ -420,6 +426,14 @@ namespace Parallel
   inline void wait (std::vector<Request> &r)
   { for (unsigned int i=0; i<r.size(); i++) r[i].wait(); }
 
+  /**
+   * Wait for any one of the non-blocking sends or receives in \p r
+   * to finish, and return its index.  At least one of them must not
+   * have finished yet.  This allows received messages to be handled
+   * in the order they arrive.
+   */
+  inline unsigned int waitany (std::vector<Request> &r);
+
 
 
   /**
@@ -587,6 +601,10 @@ namespace Parallel
     mutable std::map<int, unsigned int> used_tag_values;
     bool          _I_duped_it;
 
+    // The number of sparse_exchange() calls so far, which picks the
+    // message tag of the next one
+    mutable unsigned int _n_sparse_exchanges;
+
   // Communication operations:
   public:
 
@@ -1035,6 +1053,25 @@ namespace Parallel
     template <typename T>
     inline void alltoall(std::vector<T> &r) const;
 
+    /**
+     * Sends each vector in \p send to the processor it is mapped to,
+     * and replaces the contents of \p received with the vectors sent
+     * to this processor, mapped to the processors which sent them.
+     * Empty vectors are not sent.
+     *
+     * Only the processors which actually exchange data communicate,
+     * and no processor needs to know beforehand which others will
+     * send to it, so this is much cheaper than a loop of
+     * \p send_receive calls over every processor when each one only
+     * shares data with a few neighbors.
+     *
+     * This function is collective and therefore must be called by all
+     * processors in the Communicator.
+     */
+    template <typename T>
+    inline void sparse_exchange(const std::map<unsigned int, std::vector<T> > &send,
+                                std::map<unsigned int, std::vector<T> > &received) const;
+
     /**
      * Take a local value and broadcast it to all processors.
      * Optionally takes the \p root_id processor, which specifies
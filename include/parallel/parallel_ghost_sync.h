@@ -29,6 +29,8 @@
 #include "libmesh/parallel.h"
 
 // C++ Includes   -----------------------------------
+#include <map>
+#include <vector>
 
 namespace libMesh
 {
@@ -124,79 +126,50 @@ void sync_dofobject_data_by_xyz(const Iterator&          range_begin,
   libmesh_assert(!need_map_update);
 #endif
 
-  // Count the objectss to ask each processor about
-  std::vector<unsigned int>
-    ghost_objects_from_proc(libMesh::n_processors(), 0);
+  // Request sets to send to each processor, with the coordinates of
+  // each object one after another
+  std::map<unsigned int, std::vector<Real> > requested_objs_xyz;
+  // Corresponding ids to keep track of
+  std::map<unsigned int, std::vector<unsigned int> > requested_objs_id;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       DofObjType *obj = *it;
       libmesh_assert (obj);
       unsigned int obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<Real> >
-    requested_objs_x(libMesh::n_processors()),
-    requested_objs_y(libMesh::n_processors()),
-    requested_objs_z(libMesh::n_processors());
-  // Corresponding ids to keep track of
-  std::vector<std::vector<unsigned int> >
-    requested_objs_id(libMesh::n_processors());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (unsigned int p=0; p != libMesh::n_processors(); ++p)
-    if (p != libMesh::processor_id())
-      {
-        requested_objs_x[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_y[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_z[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObjType *obj = *it;
-      unsigned int obj_procid = obj->processor_id();
       if (obj_procid == libMesh::processor_id() ||
           obj_procid == DofObject::invalid_processor_id)
         continue;
 
       Point p = location_map.point_of(*obj);
-      requested_objs_x[obj_procid].push_back(p(0));
-      requested_objs_y[obj_procid].push_back(p(1));
-      requested_objs_z[obj_procid].push_back(p(2));
+      std::vector<Real> &xyz = requested_objs_xyz[obj_procid];
+      xyz.push_back(p(0));
+      xyz.push_back(p(1));
+      xyz.push_back(p(2));
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
-  // Trade requests with other processors
-  for (unsigned int p=1; p != libMesh::n_processors(); ++p)
+  // Trade requests with the processors we share objects with
+  std::map<unsigned int, std::vector<Real> > requests_to_fill;
+  CommWorld.sparse_exchange(requested_objs_xyz, requests_to_fill);
+
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> > data;
+
+  typename std::map<unsigned int, std::vector<Real> >::const_iterator
+    request_it = requests_to_fill.begin();
+  for (; request_it != requests_to_fill.end(); ++request_it)
     {
-      // Trade my requests with processor procup and procdown
-      unsigned int procup = (libMesh::processor_id() + p) %
-                             libMesh::n_processors();
-      unsigned int procdown = (libMesh::n_processors() +
-                               libMesh::processor_id() - p) %
-                               libMesh::n_processors();
-      std::vector<Real> request_to_fill_x,
-                        request_to_fill_y,
-                        request_to_fill_z;
-      CommWorld.send_receive(procup, requested_objs_x[procup],
-                             procdown, request_to_fill_x);
-      CommWorld.send_receive(procup, requested_objs_y[procup],
-                             procdown, request_to_fill_y);
-      CommWorld.send_receive(procup, requested_objs_z[procup],
-                             procdown, request_to_fill_z);
+      const std::vector<Real> &request_to_fill_xyz = request_it->second;
+      libmesh_assert_equal_to (request_to_fill_xyz.size() % 3, 0);
 
       // Find the local id of each requested object
-      std::vector<unsigned int> request_to_fill_id(request_to_fill_x.size());
-      for (unsigned int i=0; i != request_to_fill_x.size(); ++i)
+      std::vector<unsigned int>
+        request_to_fill_id(request_to_fill_xyz.size() / 3);
+      for (unsigned int i=0; i != request_to_fill_id.size(); ++i)
         {
-          Point p(request_to_fill_x[i],
-                  request_to_fill_y[i],
-                  request_to_fill_z[i]);
+          Point p(request_to_fill_xyz[3*i],
+                  request_to_fill_xyz[3*i+1],
+                  request_to_fill_xyz[3*i+2]);
 
           // Look for this object in the multimap
           DofObjType *obj = location_map.find(p);
@@ -210,18 +183,24 @@ void sync_dofobject_data_by_xyz(const Iterator&          range_begin,
         }
 
       // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      CommWorld.send_receive(procdown, data,
-                             procup, received_data);
-      libmesh_assert_equal_to (requested_objs_x[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
+      sync.gather_data(request_to_fill_id, data[request_it->first]);
+    }
+
+  // Trade back the results
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> >
+    received_data;
+  CommWorld.sparse_exchange(data, received_data);
+
+  // Let the user process the results
+  std::map<unsigned int, std::vector<unsigned int> >::iterator
+    id_it = requested_objs_id.begin();
+  for (; id_it != requested_objs_id.end(); ++id_it)
+    {
+      std::vector<typename SyncFunctor::datum> &proc_data =
+        received_data[id_it->first];
+      libmesh_assert_equal_to (id_it->second.size(), proc_data.size());
+
+      sync.act_on_data(id_it->second, proc_data);
     }
 }
 
@@ -236,34 +215,14 @@ void sync_dofobject_data_by_id(const Iterator& range_begin,
   // This function must be run on all processors at once
   parallel_only();
 
-  // Count the objects to ask each processor about
-  std::vector<unsigned int>
-    ghost_objects_from_proc(libMesh::n_processors(), 0);
+  // Request sets to send to each processor
+  std::map<unsigned int, std::vector<unsigned int> > requested_objs_id;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       DofObject *obj = *it;
       libmesh_assert (obj);
       unsigned int obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<unsigned int> >
-    requested_objs_id(libMesh::n_processors());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (unsigned int p=0; p != libMesh::n_processors(); ++p)
-    if (p != libMesh::processor_id())
-      {
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-      }
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObject *obj = *it;
-      unsigned int obj_procid = obj->processor_id();
       if (obj_procid == libMesh::processor_id() ||
           obj_procid == DofObject::invalid_processor_id)
         continue;
@@ -271,32 +230,33 @@ void sync_dofobject_data_by_id(const Iterator& range_begin,
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
-  // Trade requests with other processors
-  for (unsigned int p=1; p != libMesh::n_processors(); ++p)
+  // Trade requests with the processors we share objects with
+  std::map<unsigned int, std::vector<unsigned int> > requests_to_fill;
+  CommWorld.sparse_exchange(requested_objs_id, requests_to_fill);
+
+  // Gather whatever data the user wants
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> > data;
+
+  std::map<unsigned int, std::vector<unsigned int> >::const_iterator
+    request_it = requests_to_fill.begin();
+  for (; request_it != requests_to_fill.end(); ++request_it)
+    sync.gather_data(request_it->second, data[request_it->first]);
+
+  // Trade back the results
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> >
+    received_data;
+  CommWorld.sparse_exchange(data, received_data);
+
+  // Let the user process the results
+  std::map<unsigned int, std::vector<unsigned int> >::iterator
+    id_it = requested_objs_id.begin();
+  for (; id_it != requested_objs_id.end(); ++id_it)
     {
-      // Trade my requests with processor procup and procdown
-      unsigned int procup = (libMesh::processor_id() + p) %
-                             libMesh::n_processors();
-      unsigned int procdown = (libMesh::n_processors() +
-                               libMesh::processor_id() - p) %
-                               libMesh::n_processors();
-      std::vector<unsigned int> request_to_fill_id;
-      CommWorld.send_receive(procup, requested_objs_id[procup],
-                             procdown, request_to_fill_id);
+      std::vector<typename SyncFunctor::datum> &proc_data =
+        received_data[id_it->first];
+      libmesh_assert_equal_to (id_it->second.size(), proc_data.size());
 
-      // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      CommWorld.send_receive(procdown, data,
-                             procup, received_data);
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                               received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
+      sync.act_on_data(id_it->second, proc_data);
     }
 }
 
@@ -314,38 +274,16 @@ void sync_element_data_by_parent_id(MeshBase&       mesh,
   // This function must be run on all processors at once
   parallel_only();
 
-  // Count the objects to ask each processor about
-  std::vector<unsigned int>
-    ghost_objects_from_proc(libMesh::n_processors(), 0);
-
-  for (Iterator it = range_begin; it != range_end; ++it)
-    {
-      DofObject *obj = *it;
-      libmesh_assert (obj);
-      unsigned int obj_procid = obj->processor_id();
-      if (obj_procid != DofObject::invalid_processor_id)
-        ghost_objects_from_proc[obj_procid]++;
-    }
-
-  // Request sets to send to each processor
-  std::vector<std::vector<unsigned int> >
-    requested_objs_id(libMesh::n_processors()),
-    requested_objs_parent_id(libMesh::n_processors()),
-    requested_objs_child_num(libMesh::n_processors());
-
-  // We know how many objects live on each processor, so reserve()
-  // space for each.
-  for (unsigned int p=0; p != libMesh::n_processors(); ++p)
-    if (p != libMesh::processor_id())
-      {
-        requested_objs_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_parent_id[p].reserve(ghost_objects_from_proc[p]);
-        requested_objs_child_num[p].reserve(ghost_objects_from_proc[p]);
-      }
+  // Request sets to send to each processor, with the parent id and
+  // child number of each element one after another
+  std::map<unsigned int, std::vector<unsigned int> >
+    requested_objs_id,
+    requested_objs_parent_id_child_num;
 
   for (Iterator it = range_begin; it != range_end; ++it)
     {
       Elem *elem = *it;
+      libmesh_assert (elem);
       unsigned int obj_procid = elem->processor_id();
       if (obj_procid == libMesh::processor_id() ||
           obj_procid == DofObject::invalid_processor_id)
@@ -355,54 +293,65 @@ void sync_element_data_by_parent_id(MeshBase&       mesh,
         continue;
 
       requested_objs_id[obj_procid].push_back(elem->id());
-      requested_objs_parent_id[obj_procid].push_back(parent->id());
-      requested_objs_child_num[obj_procid].push_back
-	(parent->which_child_am_i(elem));
+
+      std::vector<unsigned int> &parent_id_child_num =
+        requested_objs_parent_id_child_num[obj_procid];
+      parent_id_child_num.push_back(parent->id());
+      parent_id_child_num.push_back(parent->which_child_am_i(elem));
     }
 
-  // Trade requests with other processors
-  for (unsigned int p=1; p != libMesh::n_processors(); ++p)
+  // Trade requests with the processors we share elements with
+  std::map<unsigned int, std::vector<unsigned int> > requests_to_fill;
+  CommWorld.sparse_exchange(requested_objs_parent_id_child_num,
+                            requests_to_fill);
+
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> > data;
+
+  std::map<unsigned int, std::vector<unsigned int> >::const_iterator
+    request_it = requests_to_fill.begin();
+  for (; request_it != requests_to_fill.end(); ++request_it)
     {
-      // Trade my requests with processor procup and procdown
-      unsigned int procup = (libMesh::processor_id() + p) %
-                             libMesh::n_processors();
-      unsigned int procdown = (libMesh::n_processors() +
-                               libMesh::processor_id() - p) %
-                               libMesh::n_processors();
-      std::vector<unsigned int> request_to_fill_parent_id,
-                                request_to_fill_child_num;
-      CommWorld.send_receive(procup, requested_objs_parent_id[procup],
-                             procdown, request_to_fill_parent_id);
-      CommWorld.send_receive(procup, requested_objs_child_num[procup],
-                             procdown, request_to_fill_child_num);
+      const std::vector<unsigned int> &request_to_fill_parent_id_child_num =
+        request_it->second;
+      libmesh_assert_equal_to
+        (request_to_fill_parent_id_child_num.size() % 2, 0);
 
       // Find the id of each requested element
-      unsigned int request_size = request_to_fill_parent_id.size();
+      unsigned int request_size =
+        request_to_fill_parent_id_child_num.size() / 2;
       std::vector<unsigned int> request_to_fill_id(request_size);
       for (unsigned int i=0; i != request_size; ++i)
 	{
-          Elem *parent = mesh.elem(request_to_fill_parent_id[i]);
+          Elem *parent =
+            mesh.elem(request_to_fill_parent_id_child_num[2*i]);
           libmesh_assert(parent);
           libmesh_assert(parent->has_children());
-          Elem *child = parent->child(request_to_fill_child_num[i]);
+          Elem *child =
+            parent->child(request_to_fill_parent_id_child_num[2*i+1]);
           libmesh_assert(child);
           libmesh_assert(child->active());
           request_to_fill_id[i] = child->id();
 	}
 
       // Gather whatever data the user wants
-      std::vector<typename SyncFunctor::datum> data;
-      sync.gather_data(request_to_fill_id, data);
-
-      // Trade back the results
-      std::vector<typename SyncFunctor::datum> received_data;
-      CommWorld.send_receive(procdown, data,
-                             procup, received_data);
-      libmesh_assert_equal_to (requested_objs_id[procup].size(),
-                              received_data.size());
-
-      // Let the user process the results
-      sync.act_on_data(requested_objs_id[procup], received_data);
+      sync.gather_data(request_to_fill_id, data[request_it->first]);
+    }
+
+  // Trade back the results
+  std::map<unsigned int, std::vector<typename SyncFunctor::datum> >
+    received_data;
+  CommWorld.sparse_exchange(data, received_data);
+
+  // Let the user process the results
+  std::map<unsigned int, std::vector<unsigned int> >::iterator
+    id_it = requested_objs_id.begin();
+  for (; id_it != requested_objs_id.end(); ++id_it)
+    {
+      std::vector<typename SyncFunctor::datum> &proc_data =
+        received_data[id_it->first];
+      libmesh_assert_equal_to (id_it->second.size(), proc_data.size());
+
+      sync.act_on_data(id_it->second, proc_data);
     }
 }
 #else
@@ -426,7 +426,8 @@ inline Communicator::Communicator () :
       _rank(0),
       _size(1),
       used_tag_values(),
-      _I_duped_it(false) {}
+      _I_duped_it(false),
+      _n_sparse_exchanges(0) {}
 
 inline Communicator::Communicator (const communicator &comm) :
 #ifdef LIBMESH_HAVE_MPI
@@ -435,7 +436,8 @@ inline Communicator::Communicator (const communicator &comm) :
       _rank(0),
       _size(1),
       used_tag_values(),
-      _I_duped_it(false)
+      _I_duped_it(false),
+      _n_sparse_exchanges(0)
 {
   this->assign(comm);
 }
@@ -497,7 +499,8 @@ inline Communicator::Communicator (const Communicator &) :
   _rank(0),
   _size(1),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   libmesh_error();
 }
@@ -744,6 +747,44 @@ inline void Request::add_post_wait_work(PostWaitWork* work)
 
 
 
+inline unsigned int waitany (std::vector<Request> &r)
+{
+  libmesh_assert(!r.empty());
+
+#ifdef LIBMESH_HAVE_MPI
+  START_LOG("waitany()", "Parallel");
+
+  std::vector<request> raw(r.size());
+  for (unsigned int i=0; i != r.size(); ++i)
+    raw[i] = *r[i].get();
+
+  int index = MPI_UNDEFINED;
+
+#ifndef NDEBUG
+  // Only catch the return value when asserts are active.
+  const int ierr =
+#endif
+    MPI_Waitany (raw.size(), &raw[0], &index, MPI_STATUS_IGNORE);
+  libmesh_assert (ierr == MPI_SUCCESS);
+  libmesh_assert_not_equal_to (index, MPI_UNDEFINED);
+
+  STOP_LOG("waitany()", "Parallel");
+
+  // MPI_Waitany has freed the finished request, so waiting on it now
+  // just does any work which was posted for after the wait
+  *r[index].get() = raw[index];
+  r[index].wait();
+
+  return index;
+#else
+  // Without MPI there is never anything to wait for
+  libmesh_error();
+  return 0;
+#endif
+}
+
+
+
 inline void barrier (const Communicator &comm = Communicator_World)
 {
   comm.barrier();
@@ -1028,6 +1069,12 @@ inline void alltoall(std::vector<T> &r,
                      const Communicator &comm = Communicator_World)
 { comm.alltoall(r); }
 
+template <typename T>
+inline void sparse_exchange(const std::map<unsigned int, std::vector<T> > &send,
+                            std::map<unsigned int, std::vector<T> > &received,
+                            const Communicator &comm = Communicator_World)
+{ comm.sparse_exchange(send, received); }
+
 template <typename T>
 inline void broadcast(T &data, const unsigned int root_id=0,
                       const Communicator &comm = Communicator_World)
@@ -1064,6 +1111,24 @@ MessageTag::MessageTag(const MessageTag &other)
 }
 
 
+inline
+MessageTag& MessageTag::operator= (const MessageTag &other)
+{
+  // Reference the new tag before dereferencing the old one, in case
+  // they are the same
+  if (other._comm)
+    other._comm->reference_unique_tag(other._tagvalue);
+
+  if (_comm)
+    _comm->dereference_unique_tag(_tagvalue);
+
+  _tagvalue = other._tagvalue;
+  _comm = other._comm;
+
+  return *this;
+}
+
+
 inline
 MessageTag Communicator::get_unique_tag(int tagvalue) const
 {
@@ -2772,6 +2837,137 @@ inline void Communicator::alltoall(std::vector<T> &buf) const
 
 
 
+template <typename T>
+inline void Communicator::sparse_exchange(const std::map<unsigned int, std::vector<T> > &send,
+                                          std::map<unsigned int, std::vector<T> > &received) const
+{
+  received.clear();
+
+  typedef typename std::map<unsigned int, std::vector<T> >::const_iterator
+    send_iterator;
+
+  // Our own data never leaves this processor
+  send_iterator it = send.find(this->rank());
+  if (it != send.end() && !it->second.empty())
+    received[this->rank()] = it->second;
+
+  if (this->size() < 2)
+    return;
+
+  START_LOG("sparse_exchange()", "Parallel");
+
+  // Consecutive exchanges alternate between two tags: a processor
+  // can only start a second exchange after every processor has
+  // received all its messages of the first one, but it can start
+  // a third before a slower processor has noticed the second one
+  // finish.
+  const MessageTag tag =
+    this->get_unique_tag(31420 + (_n_sparse_exchanges++ % 2));
+
+  std::vector<MPI_Request> send_requests;
+  send_requests.reserve(send.size());
+
+  for (it = send.begin(); it != send.end(); ++it)
+    {
+      const unsigned int dest_processor_id = it->first;
+      const std::vector<T> &buf = it->second;
+
+      libmesh_assert_less (dest_processor_id, this->size());
+
+      if (dest_processor_id == this->rank() || buf.empty())
+        continue;
+
+      StandardType<T> send_type(&buf[0]);
+
+      send_requests.push_back(MPI_REQUEST_NULL);
+
+#ifndef NDEBUG
+      // Only catch the return value when asserts are active.
+      const int ierr =
+#endif
+        // A synchronous send only completes once it is being
+        // received, which is what lets the exchange below tell when
+        // every message has arrived.
+        MPI_Issend (const_cast<T*>(&buf[0]),
+                    buf.size(),
+                    send_type,
+                    dest_processor_id,
+                    tag.value(),
+                    this->get(),
+                    &send_requests.back());
+      libmesh_assert (ierr == MPI_SUCCESS);
+    }
+
+#if MPI_VERSION > 2
+  // Receive whatever arrives until every processor is known to have
+  // had all its messages received: each processor enters a
+  // nonblocking barrier once its own sends have been matched, so the
+  // barrier completes only after all the messages are in.
+  MPI_Request barrier_request = MPI_REQUEST_NULL;
+  bool barrier_started = false;
+
+  while (true)
+    {
+      int message_waiting = 0;
+      status stat;
+      MPI_Iprobe (MPI_ANY_SOURCE,
+                  tag.value(),
+                  this->get(),
+                  &message_waiting,
+                  &stat);
+
+      if (message_waiting)
+        {
+          const unsigned int src_processor_id = stat.MPI_SOURCE;
+          libmesh_assert (!received.count(src_processor_id));
+          this->receive(src_processor_id, received[src_processor_id], tag);
+          continue;
+        }
+
+      int done = 0;
+      if (barrier_started)
+        {
+          MPI_Test (&barrier_request, &done, MPI_STATUS_IGNORE);
+          if (done)
+            break;
+        }
+      else
+        {
+          MPI_Testall (send_requests.size(),
+                       send_requests.empty() ? NULL : &send_requests[0],
+                       &done,
+                       MPI_STATUSES_IGNORE);
+          if (done)
+            {
+              MPI_Ibarrier (this->get(), &barrier_request);
+              barrier_started = true;
+            }
+        }
+    }
+#else
+  // Without nonblocking collectives, count the messages each
+  // processor is sent first, then wait for the ones sent to us.
+  std::vector<unsigned int> n_messages_from(this->size(), 0);
+  for (it = send.begin(); it != send.end(); ++it)
+    if (it->first != this->rank() && !it->second.empty())
+      n_messages_from[it->first] = 1;
+
+  this->alltoall(n_messages_from);
+
+  for (unsigned int p=0; p != this->size(); ++p)
+    if (n_messages_from[p])
+      this->receive(p, received[p], tag);
+
+  if (!send_requests.empty())
+    MPI_Waitall (send_requests.size(), &send_requests[0],
+                 MPI_STATUSES_IGNORE);
+#endif
+
+  STOP_LOG("sparse_exchange()", "Parallel");
+}
+
+
+
 template <typename T>
 inline void Communicator::broadcast (T &data, const unsigned int root_id) const
 {
@@ -3109,6 +3305,18 @@ inline void Communicator::allgather(std::vector<T> &, const bool) const {}
 template <typename T>
 inline void Communicator::alltoall(std::vector<T> &) const {}
 
+template <typename T>
+inline void Communicator::sparse_exchange(const std::map<unsigned int, std::vector<T> > &send,
+                                          std::map<unsigned int, std::vector<T> > &received) const
+{
+  received.clear();
+
+  typename std::map<unsigned int, std::vector<T> >::const_iterator
+    it = send.find(0);
+  if (it != send.end() && !it->second.empty())
+    received[0] = it->second;
+}
+
 template <typename T>
 inline void Communicator::broadcast (T &, const unsigned int root_id) const
 { libmesh_assert_equal_to(root_id, 0); }
@@ -0,0 +1,208 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __checkpoint_writer_h__
+#define __checkpoint_writer_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/enum_xdr_mode.h"
+#include "libmesh/equation_systems.h"
+#include "libmesh/threads.h"
+#include "libmesh/xdr_buffer.h"
+
+// C++ includes
+#include <string>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Xdr;
+
+/**
+ * This class writes checkpoints of an \p EquationSystems object in
+ * the background.  \p write() copies the values of every processor
+ * into memory and returns, and the per-processor files are then
+ * written, closed, and compressed if their names end in \p .bz2 or
+ * \p .xz, by another thread while the computation goes on:
+ *
+ * \verbatim
+ *   CheckpointWriter checkpoint;
+ *
+ *   for (unsigned int t_step=0; ...)
+ *     {
+ *       ...
+ *       checkpoint.write (es, "out.xdr",
+ *                         EquationSystems::WRITE_DATA |
+ *                         EquationSystems::WRITE_ADDITIONAL_DATA);
+ *     }
+ *
+ *   checkpoint.wait();
+ * \endverbatim
+ *
+ * A checkpoint is complete on disk once \p wait() returns.  The
+ * next \p write() waits for the previous checkpoint first, so one
+ * checkpoint at a time is held in memory.
+ *
+ * The files are the same as \p EquationSystems::write() writes with
+ * \p WRITE_PARALLEL_FILES, and are read back by
+ * \p EquationSystems::read().  The header file is written by
+ * processor 0 before \p write() returns.
+ *
+ * Writing the mesh is out of scope: a checkpoint only holds the
+ * \p EquationSystems data.  Meshes which change between checkpoints
+ * can be written alongside them by \p XdrIO with
+ * \p set_write_parallel(), which writes one file per processor
+ * as well, but blocks until they are written.
+ *
+ * The writing thread is a \p Threads::Thread.  When the library is
+ * built without thread support the files are written before
+ * \p write() returns, as \p EquationSystems::write() would.
+ */
+
+// ------------------------------------------------------------
+// CheckpointWriter class definition
+class CheckpointWriter
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  CheckpointWriter ();
+
+  /**
+   * Destructor.  Waits for any checkpoint still being written.
+   */
+  ~CheckpointWriter ();
+
+  /**
+   * Starts writing a checkpoint of \p es to \p name, as
+   * \p EquationSystems::write() would with \p write_flags and
+   * \p WRITE_PARALLEL_FILES.  Returns once the data has been copied,
+   * after waiting for the previous checkpoint if it is still being
+   * written.
+   *
+   * This function is collective and therefore must be called by all
+   * processors.
+   */
+  void write (const EquationSystems& es,
+              const std::string& name,
+              const unsigned int write_flags = EquationSystems::WRITE_DATA);
+
+  /**
+   * Same, but with an explicit \p XdrMODE.
+   */
+  void write (const EquationSystems& es,
+              const std::string& name,
+              const libMeshEnums::XdrMODE mode,
+              const unsigned int write_flags = EquationSystems::WRITE_DATA);
+
+  /**
+   * Blocks until this processor's file of the last checkpoint has
+   * been written and closed.
+   */
+  void wait ();
+
+  /**
+   * @returns the number of checkpoints started.
+   */
+  unsigned int n_checkpoints () const { return _n_checkpoints; }
+
+  /**
+   * @returns the total time in seconds the caller has spent in
+   * \p write() and \p wait(): copying data, writing the header and
+   * waiting for earlier checkpoints.
+   */
+  double blocking_time () const { return _blocking_time; }
+
+  /**
+   * @returns the total time in seconds spent writing files in the
+   * background while the caller was not waiting for them.
+   */
+  double overlapped_time () const { return _overlapped_time; }
+
+private:
+
+  friend class EquationSystems;
+
+  /**
+   * Starts writing the contents of \p buffer, which are taken
+   * over, to \p file_name in the background.  Called by
+   * \p EquationSystems::write().
+   */
+  void start (const std::string& file_name,
+              const libMeshEnums::XdrMODE mode,
+              XdrBuffer& buffer);
+
+  /**
+   * Joins the writing thread, if a checkpoint is being written, and
+   * reports a failed compression.
+   */
+  void finish ();
+
+  /**
+   * The data of the checkpoint being written.
+   */
+  XdrBuffer _buffer;
+
+  /**
+   * The file it is being written to.  The writing thread closes it.
+   */
+  AutoPtr<Xdr> _io;
+
+  /**
+   * The command compressing the file once it is closed, if its name
+   * asks for compression.
+   */
+  std::string _zip_command;
+
+  /**
+   * The exit status of \p _zip_command, set by the thread.
+   */
+  int _zip_status;
+
+  /**
+   * The thread writing it.
+   */
+  AutoPtr<Threads::Thread> _thread;
+
+  /**
+   * The time taken to start the thread, which includes the writing
+   * itself when threads are not available.
+   */
+  double _start_time;
+
+  /**
+   * The time the thread took to write the data, set by the thread.
+   */
+  double _write_time;
+
+  unsigned int _n_checkpoints;
+
+  double _blocking_time;
+
+  double _overlapped_time;
+};
+
+} // namespace libMesh
+
+#endif // #define __checkpoint_writer_h__
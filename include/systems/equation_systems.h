@@ -45,6 +45,7 @@ namespace libMesh
 {
 
 // Forward Declarations
+class CheckpointWriter;
 class MeshData;
 class Elem;
 class MeshBase;
@@ -283,6 +284,22 @@ public:
   void build_solution_vector (std::vector<Number>& soln,
                               const std::set<std::string>* system_names=NULL) const;
 
+  /**
+   * Fill the input vector \p soln with the solution values at the
+   * nodes of the active local elements, whose ids are returned in
+   * \p node_ids in ascending order.  The entries are in the same
+   * format as those of \p build_solution_vector(), with node \p
+   * node_ids[n] in place of node \p n.  No global vector is built:
+   * the values come from each system's \p current_local_solution, so
+   * the systems must be up to date.  Values of discontinuous variables
+   * are averaged over the local elements only.
+   * If systems_names!=NULL, only include data from the
+   * specified systems.
+   */
+  void build_local_solution_vector (std::vector<unsigned int>& node_ids,
+                                    std::vector<Number>& soln,
+                                    const std::set<std::string>* system_names=NULL) const;
+
   /**
    * Retrieve the solution data for CONSTANT MONOMIALs.  If \p names
    * is populated, only the variables corresponding to those names will
@@ -448,6 +465,21 @@ private:
 		   const libMeshEnums::XdrMODE,
 		   const unsigned int read_flags);
 
+  /**
+   * Actual write implementation.  If \p writer is not \p NULL the
+   * data for this processor's file is only copied, and \p writer
+   * writes it in the background.
+   */
+  void _write (const std::string& name,
+	       const libMeshEnums::XdrMODE,
+	       const unsigned int write_flags,
+	       CheckpointWriter *writer) const;
+
+  /**
+   * \p CheckpointWriter calls \p _write().
+   */
+  friend class CheckpointWriter;
+
   /**
    * This function is used in the implementation of add_system,
    * it loops over the nodes and elements of the Mesh, adding the
@@ -38,6 +38,7 @@ namespace libMesh
 {
 
   // Forward Declarations
+  class AffineMapBatch;
   class BoundaryInfo;
   class Elem;
   template <typename T> class FEGenericBase;
@@ -490,6 +491,21 @@ public:
    */
   void elem_fe_reinit();
 
+  /**
+   * Precomputes, in one pass, the interior maps of those elements in
+   * [\p begin, \p end) which have affine maps (e.g. linear simplices)
+   * and share the type and p level of the first such element.  Later
+   * calls to elem_fe_reinit() on those elements copy the precomputed
+   * map instead of computing it.  Does nothing on a moving mesh.
+   */
+  void build_affine_map_batch(std::vector<const Elem*>::const_iterator begin,
+                              std::vector<const Elem*>::const_iterator end);
+
+  /**
+   * Discards any maps precomputed by build_affine_map_batch().
+   */
+  void clear_affine_map_batch();
+
   /**
    * Reinitializes side FE objects on the current geometric element
    */
@@ -676,6 +692,11 @@ protected:
    */
   BoundaryInfo* _boundary_info;
 
+  /**
+   * Precomputed interior maps for a block of affine elements, if any.
+   */
+  AffineMapBatch* _affine_map_batch;
+
 private:
   /**
    * Uses the coordinate data specified by mesh_*_position configuration
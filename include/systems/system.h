@@ -48,6 +48,7 @@ class SystemNorm;
 class EquationSystems;
 class MeshBase;
 class Xdr;
+class XdrBuffer;
 class DofMap;
 template <typename Output> class FunctionBase;
 class Parameters;
@@ -1146,9 +1147,31 @@ public:
    * This method may safely be called on a distributed-memory mesh.
    * This method will read an individual file for each processor in the simulation
    * where the local solution components for that processor are stored.
+   * If the header read by \p read_header() says the files hold object
+   * ids, as \p write_parallel_data() now writes them, \p io is read
+   * by the overload below, so the values go to whichever processors
+   * now own them.  Files written without object ids, by an older
+   * version of the library, must be read on the same number of
+   * processors and with the same partitioning.
    */
   void read_parallel_data (Xdr &io,
 			   const bool read_additional_data);
+
+  /**
+   * Reads additional data, namely vectors, for this System from the
+   * per-processor files written by \p write_parallel_data().  Each
+   * processor reads the files in \p io, which may be any share of
+   * them, including none, and the values are then sent on to the
+   * processors which own the corresponding objects.  The files can
+   * therefore be read on a different number of processors than
+   * wrote them.  If every processor reads just the file it wrote,
+   * nothing needs to be sent.
+   *
+   * This method is collective and therefore must be called by all
+   * processors.
+   */
+  void read_parallel_data (const std::vector<Xdr*> &io,
+			   const bool read_additional_data);
   /**
    * Writes the basic data header for this System.
    */
@@ -1176,10 +1199,20 @@ public:
    * This method may safely be called on a distributed-memory mesh.
    * This method will create an individual file for each processor in the simulation
    * where the local solution components for that processor will be stored.
+   * The ids of the nodes and elements are stored with their values,
+   * so that the files can be read back on any number of processors.
    */
   void write_parallel_data (Xdr &io,
 			    const bool write_additional_data) const;
 
+  /**
+   * Copies the data which \p write_parallel_data() would write into
+   * \p buffer instead, so that it can be written out later while
+   * the values of the system keep changing.
+   */
+  void write_parallel_data (XdrBuffer &buffer,
+			    const bool write_additional_data) const;
+
   /**
    * @returns a string containing information about the
    * system.
@@ -1559,6 +1592,14 @@ private:
 						     Xdr &io,
 						     const unsigned int var_to_write=libMesh::invalid_uint) const;
 
+  /**
+   * Writes the data for \p write_parallel_data() to \p io, which may
+   * be an \p Xdr object or an \p XdrBuffer.
+   */
+  template <typename OutputType>
+  void write_parallel_data_to (OutputType &io,
+			       const bool write_additional_data) const;
+
   /**
    * Writes the SCALAR dofs associated with var to the stream \p io.
    */
@@ -1724,6 +1765,13 @@ private:
    */
   bool _additional_data_written;
 
+  /**
+   * This flag is used only when *reading* in a system from file.
+   * Based on the version of the file header, it keeps track of
+   * whether the parallel files hold object ids with their values.
+   */
+  bool _indexed_data_written;
+
   /**
    * This vector is used only when *reading* in a system from file.
    * Based on the system header, it keeps track of any index remapping
@@ -0,0 +1,169 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __object_pool_h__
+#define __object_pool_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This class hands out the memory for many small objects, such as
+ * the elements and nodes of a mesh, from large blocks instead of
+ * with one heap allocation per object.  Requests are grouped by
+ * size, so each type of object gets blocks of its own, and the memory
+ * of a freed object is reused by the next request of the same size.
+ *
+ * Each mesh owns a pool for the nodes it adds and one for the
+ * children refinement builds, and returns their blocks to the heap
+ * in bulk when it is cleared.  An object does not need to know
+ * its pool to be freed: every block starts with a pointer to the pool
+ * which owns it, and blocks are aligned to their size, so
+ * \p deallocate() finds the block of an object from its address.
+ *
+ * Each size has its own lock, so that objects may be allocated and
+ * freed from several threads at once.
+ */
+
+// ------------------------------------------------------------
+// ObjectPool class definition
+class ObjectPool
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  ObjectPool ();
+
+  /**
+   * Destructor.  Returns all the blocks to the heap, whether or not
+   * their objects have been freed.
+   */
+  ~ObjectPool ();
+
+  /**
+   * @returns memory for an object of \p size bytes.  Objects larger
+   * than \p max_size get a block of their own.
+   */
+  void* allocate (const std::size_t size);
+
+  /**
+   * Frees the memory of an object, which may come from any pool.
+   */
+  static void deallocate (void* p);
+
+  /**
+   * Returns the blocks of every size with no objects left in them
+   * to the heap.
+   */
+  void release_memory ();
+
+  /**
+   * @returns the number of bytes currently held in blocks.
+   */
+  std::size_t n_bytes () const;
+
+  /**
+   * The largest object size which is pooled.
+   */
+  static const std::size_t max_size = 1024;
+
+private:
+
+  /**
+   * Pools are not copied.
+   */
+  ObjectPool (const ObjectPool&);
+  ObjectPool& operator= (const ObjectPool&);
+
+  /**
+   * Object sizes are rounded up to a multiple of \p granularity,
+   * which keeps every object suitably aligned.
+   */
+  static const std::size_t granularity = 16;
+
+  /**
+   * The number of pooled sizes.
+   */
+  static const std::size_t n_sizes = max_size / granularity;
+
+  /**
+   * The size and the alignment of each block.
+   */
+  static const std::size_t block_size = 65536;
+
+  /**
+   * The start of every block, padded to \p granularity bytes.
+   */
+  struct BlockHeader
+  {
+    ObjectPool* pool;
+
+    // The index of the size of the block's objects, or n_sizes
+    // for a block holding one larger object
+    std::size_t size;
+  };
+
+  /**
+   * @returns a new block of \p n_bytes, aligned to \p block_size,
+   * with its header filled in.
+   */
+  char* new_block (const std::size_t size,
+                   const std::size_t n_bytes);
+
+  /**
+   * The blocks and free objects of one size.
+   */
+  struct SizeClass
+  {
+    SizeClass () : free_list(NULL), next(NULL), end(NULL), n_live(0) {}
+
+    Threads::spin_mutex mutex;
+
+    // The most recently freed object, which holds a pointer to the
+    // one freed before it
+    void* free_list;
+
+    // The part of the newest block which has never been handed out
+    char* next;
+    char* end;
+
+    std::vector<char*> blocks;
+
+    std::size_t n_live;
+  };
+
+  /**
+   * One entry per multiple of \p granularity up to \p max_size.
+   */
+  SizeClass _sizes[n_sizes];
+};
+
+} // namespace libMesh
+
+#endif // #define __object_pool_h__
@@ -23,17 +23,23 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/libmesh.h" // for libMesh::invalid_uint
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
+#include <iosfwd>
 #include <map>
-#include <stack>
 #include <string>
+#include <vector>
 #include <sys/time.h>
 
 namespace libMesh
 {
 
+// forward declarations
+class PerfThreadTrees;
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -108,6 +114,103 @@ class PerfData
 
 
 
+/**
+ * The \p PerfTree class holds the call tree of the events logged on
+ * one thread.  Each node of the tree is one event as called from one
+ * chain of enclosing events, so the time spent in an event is
+ * attributed to the context it was called from.
+ */
+
+// ------------------------------------------------------------
+// PerfTree class definition
+class PerfTree
+{
+ public:
+
+  /**
+   * Constructor.  Creates a tree with only the root node.
+   */
+  PerfTree ();
+
+  /**
+   * One node of the tree.
+   */
+  struct Node
+  {
+    Node (const unsigned int event_in,
+          const unsigned int parent_in) :
+      event(event_in),
+      parent(parent_in),
+      first_child(libMesh::invalid_uint),
+      next_sibling(libMesh::invalid_uint)
+    {}
+
+    /**
+     * The event id, or \p invalid_uint for the root.
+     */
+    unsigned int event;
+
+    /**
+     * The parent, first child and next sibling nodes.
+     */
+    unsigned int parent, first_child, next_sibling;
+
+    /**
+     * The timings of this event in this context.
+     */
+    PerfData data;
+  };
+
+  /**
+   * Returns the node for the event \p event called from node
+   * \p parent, adding it if it does not exist yet.
+   */
+  unsigned int child (const unsigned int parent,
+                      const unsigned int event);
+
+  /**
+   * Returns the tree to its freshly constructed state.
+   */
+  void clear ();
+
+  /**
+   * The nodes.  Node 0 is the root, and every node comes after its
+   * parent.
+   */
+  std::vector<Node> nodes;
+
+  /**
+   * The nodes of the currently running events, innermost last.
+   */
+  std::vector<unsigned int> stack;
+
+  /**
+   * The total time spent in logged events.
+   */
+  double total_time;
+};
+
+
+
+/**
+ * A \p PerfEventCache remembers the event id used at one
+ * \p START_LOG() or \p STOP_LOG() call site, so that the label
+ * strings only have to be looked up the first time through.
+ *
+ * Threads may share a call site, so \p id is the only field which is
+ * read before it is known to be set.  It is zero until the first
+ * lookup, which stores \p label and \p header and then publishes the
+ * event id plus one in \p id; they never change after that.
+ */
+struct PerfEventCache
+{
+  const char *label;
+  const char *header;
+  Threads::atomic<unsigned int> id;
+};
+
+
+
 /**
  * The \p PerfLog class allows monitoring of specific events.
  * An event is defined by a unique string that functions as
@@ -115,6 +218,14 @@ class PerfData
  * This class is particulary useful for finding performance
  * bottlenecks.
  *
+ * Each event label is interned to an integer id the first time it is
+ * seen, and the events are recorded in a call tree, so the time
+ * spent in an event is known for every context it was called from.
+ * Events logged from inside a \p Threads::parallel_for() or
+ * \p Threads::parallel_reduce() are recorded in a separate tree for
+ * each thread, which is merged into the main tree when the log is
+ * reported.  Their times are summed over the threads, and are not
+ * subtracted from the time of the event enclosing the threaded loop.
  */
 
 // ------------------------------------------------------------
@@ -141,10 +252,10 @@ class PerfLog
 
   /**
    * Clears all the internal data and returns the
-   * data structures to a pristine state.  This function
-   * checks to see if it is currently monitoring any
-   * events, and if so errors.  Be sure you are not
-   * logging any events when you call this function.
+   * data structures to a pristine state.  Any events
+   * still being monitored are discarded, so be sure you
+   * are not logging any events when you call this function.
+   * Event ids remain valid.
    */
   void clear();
 
@@ -163,6 +274,24 @@ class PerfLog
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Returns the id of the event \p label, registering the event if
+   * it has not been seen before.  Ids remain valid for the lifetime
+   * of the log.
+   */
+  unsigned int get_event_id (const std::string &label,
+                             const std::string &header="");
+
+  /**
+   * Push the event \p event_id onto the stack, pausing any active event.
+   */
+  void push (const unsigned int event_id);
+
+  /**
+   * Pop the event \p event_id off the stack, resuming any lower event.
+   */
+  void pop (const unsigned int event_id);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    */
@@ -175,6 +304,40 @@ class PerfLog
   void pop (const std::string &label,
 	    const std::string &header="");
 
+  /**
+   * Push the event \p label, looking up its id in \p cache.  The
+   * cache keeps the first strings it was used with, which are
+   * expected to be string literals; other strings are looked up
+   * every time.  Used by \p START_LOG().
+   */
+  void push (PerfEventCache &cache,
+             const char *label,
+             const char *header);
+
+  /**
+   * Pop the event \p label, looking up its id in \p cache.  Used by
+   * \p STOP_LOG().
+   */
+  void pop (PerfEventCache &cache,
+            const char *label,
+            const char *header);
+
+  /**
+   * Push the event \p label.  \p std::string labels are not cached.
+   */
+  void push (PerfEventCache &,
+             const std::string &label,
+             const std::string &header)
+  { this->push(label, header); }
+
+  /**
+   * Pop the event \p label.  \p std::string labels are not cached.
+   */
+  void pop (PerfEventCache &,
+            const std::string &label,
+            const std::string &header)
+  { this->pop(label, header); }
+
   /**
    * Start monitoring the event named \p label.
    */
@@ -221,6 +384,22 @@ class PerfLog
    */
   void print_log() const;
 
+  /**
+   * Writes the log to \p os as JSON: the alive and active times,
+   * every event, and the call tree, each with the minimum, maximum
+   * and average over all processors.  This function is collective,
+   * and only processor 0 writes.
+   */
+  void print_json(std::ostream &os) const;
+
+  /**
+   * Writes the events and the call tree to \p os as CSV, with one
+   * row per event and per tree node, reduced over all processors as
+   * in \p print_json().  This function is collective, and only
+   * processor 0 writes.
+   */
+  void print_csv(std::ostream &os) const;
+
   /**
    * @returns the total time spent on this event.
    */
@@ -229,6 +408,47 @@ class PerfLog
 
  private:
 
+  /**
+   * Returns the id of the event \p label, which \p cache holds
+   * unless it was first used with other strings.  Looks the id up
+   * and stores it in \p cache the first time through.
+   */
+  unsigned int cached_event_id (PerfEventCache &cache,
+                                const char *label,
+                                const char *header);
+
+  /**
+   * Stores \p label, \p header and their id in \p cache if nobody
+   * has yet, and returns the id plus one which \p cache then holds.
+   */
+  unsigned int fill_event_cache (PerfEventCache &cache,
+                                 const char *label,
+                                 const char *header);
+
+  /**
+   * Returns the tree the calling thread logs to.
+   */
+  PerfTree& local_tree();
+
+  /**
+   * Returns the node new events on \p tree are called from when no
+   * event is running on it.  For a thread tree this is the copy of
+   * the event running on the main tree.
+   */
+  unsigned int base_node(PerfTree &tree);
+
+  /**
+   * Returns the main tree with all the thread trees merged in.
+   */
+  void merged_tree(PerfTree &tree) const;
+
+  /**
+   * Fills \p flat with the timings summed over every node of each
+   * event in \p tree.
+   */
+  void flat_log(const PerfTree &tree,
+                std::map<std::pair<std::string,std::string>,
+                         PerfData> &flat) const;
 
   /**
    * The label for this object.
@@ -241,26 +461,29 @@ class PerfLog
   bool log_events;
 
   /**
-   * The total running time for recorded events.
+   * The time we were constructed or last cleared.
    */
-  double total_time;
+  struct timeval tstart;
 
   /**
-   * The time we were constructed or last cleared.
+   * The (header, label) of each event, indexed by id.
    */
-  struct timeval tstart;
+  std::vector<std::pair<std::string, std::string> > _events;
 
   /**
-   * The actual log.
+   * The id of each (header, label).
    */
-  std::map<std::pair<std::string,
-		     std::string>,
-	   PerfData> log;
+  std::map<std::pair<std::string, std::string>, unsigned int> _event_ids;
 
   /**
-   * A stack to hold the current performance log trace.
+   * The call tree of events logged outside threaded loops.
    */
-  std::stack<PerfData*> log_stack;
+  PerfTree _main;
+
+  /**
+   * The call trees of events logged inside threaded loops.
+   */
+  PerfThreadTrees *_thread_trees;
 
   /**
    * Flag indicating if print_log() has been called.
@@ -344,57 +567,44 @@ double PerfData::stopit ()
 // ------------------------------------------------------------
 // PerfLog class inline member funcions
 inline
-void PerfLog::push (const std::string &label,
-		    const std::string &header)
+unsigned int PerfLog::cached_event_id (PerfEventCache &cache,
+                                       const char *label,
+                                       const char *header)
 {
-  if (this->log_events)
-    {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData *perf_data = &(log[std::make_pair(header,label)]);
+  unsigned int id = cache.id;
 
-      if (!log_stack.empty())
-	total_time +=
-	  log_stack.top()->pause();
+  // Look the strings up the first time through, with the lock held
+  // so that only one thread fills in the cache
+  if (!id)
+    id = this->fill_event_cache(cache, label, header);
 
-      perf_data->start();
-      log_stack.push(perf_data);
-    }
+  // A call site used with other strings than the first ones
+  if (cache.label != label || cache.header != header)
+    return this->get_event_id(label, header);
+
+  return id - 1;
 }
 
 
 
 inline
-void PerfLog::pop (const std::string &libmesh_dbg_var(label),
-		   const std::string &libmesh_dbg_var(header))
+void PerfLog::push (PerfEventCache &cache,
+                    const char *label,
+                    const char *header)
 {
   if (this->log_events)
-    {
-      libmesh_assert (!log_stack.empty());
-
-#ifndef NDEBUG
-      PerfData *perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
-        {
-          std::cerr << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          std::cerr << "From top of stack of running logs:" << std::endl;
-          std::map<std::pair<std::string, std::string>, PerfData>::iterator
-            i = log.begin(), endi = log.end();
-          for (; i != endi; ++i)
-            if (&(i->second) == log_stack.top())
-              std::cerr << '(' << i->first.first << ',' << i->first.second << ')' << std::endl;
-
-          libmesh_assert_equal_to (perf_data, log_stack.top());
-        }
-#endif
+    this->push(this->cached_event_id(cache, label, header));
+}
 
-      total_time += log_stack.top()->stopit();
 
-      log_stack.pop();
 
-      if (!log_stack.empty())
-	log_stack.top()->restart();
-    }
+inline
+void PerfLog::pop (PerfEventCache &cache,
+                   const char *label,
+                   const char *header)
+{
+  if (this->log_events)
+    this->pop(this->cached_event_id(cache, label, header));
 }
 
 
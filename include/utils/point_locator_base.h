@@ -28,6 +28,8 @@
 
 // C++ includes
 #include <cstddef>
+#include <stdint.h> // uint64_t
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -101,6 +103,27 @@ public:
    */
   virtual const Elem* operator() (const Point& p) const = 0;
 
+  /**
+   * Locates the element containing \p p, starting the search from
+   * \p hint where the locator can make use of one.  Unlike
+   * \p operator(), this must not change the locator, so that it may
+   * be called concurrently.  The default implementation calls
+   * \p operator().
+   */
+  virtual const Elem* find_element (const Point& p,
+                                    const Elem* hint = NULL) const;
+
+  /**
+   * Locates the elements containing each of the \p points, in
+   * \p elems.  The points are sorted along a Morton curve through
+   * their bounding box and located across threads with
+   * \p find_element(), each lookup starting from the element found
+   * for the previous point.  This does not change the locator, so it
+   * may be called concurrently.
+   */
+  void locate (const std::vector<Point>& points,
+               std::vector<const Elem*>& elems) const;
+
   /**
    * @returns \p true when this object is properly initialized
    * and ready for use, \p false otherwise.
@@ -124,6 +147,36 @@ public:
 
 protected:
 
+  /**
+   * Fills \p order with (key, index) pairs for each of the
+   * \p points, sorted by the position of the point along a Morton
+   * curve through the bounding box of all the points.  The keys
+   * resolve 2^21 cells per direction, so that points in the small
+   * elements of strongly graded meshes still get distinct keys.
+   */
+  static void morton_order (const std::vector<Point>& points,
+                            std::vector<std::pair<uint64_t, unsigned int> >& order);
+
+  /**
+   * Walks from \p start towards \p p through face neighbors, each
+   * time crossing the side whose plane \p p lies furthest beyond, and
+   * returns the element containing \p p.  Returns \p NULL if the walk
+   * reaches the boundary or takes more than a fixed number of steps,
+   * which is only expected for points far from \p start or outside
+   * the mesh.
+   */
+  static const Elem* walk_to_point (const Elem* start,
+                                    const Point& p);
+
+  /**
+   * Finds the element containing \p p when the locator's own search
+   * missed it: walks from \p hint, if given, and only if that fails
+   * searches all the active elements.  Returns \p NULL if no active
+   * element contains \p p.
+   */
+  const Elem* walk_or_search (const Point& p,
+                              const Elem* hint) const;
+
   /**
    * Const pointer to our master, initialized to \p NULL if none
    * given.  When using multiple PointLocators, one can be assigned
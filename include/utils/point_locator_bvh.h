@@ -0,0 +1,203 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __point_locator_bvh_h__
+#define __point_locator_bvh_h__
+
+// Local Includes
+#include "libmesh/libmesh.h"
+#include "libmesh/mesh_tools.h"
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+
+// Forward Declarations
+class MeshBase;
+class Point;
+class Elem;
+
+
+/**
+ * This is a point locator which uses a bounding volume hierarchy
+ * over the bounding boxes of the active elements.  The elements are
+ * sorted along a Morton curve through the mesh, grouped in leaves of a
+ * few consecutive elements, and the leaves are merged pairwise, level
+ * by level, into a balanced binary tree.  Every element is stored
+ * once, and the whole hierarchy lives in two flat arrays, so its
+ * size only depends on the number of elements and not on how the mesh
+ * is graded.  The element bounding boxes, the leaves and each level of
+ * the tree are computed across threads.
+ *
+ * Use \p PointLocatorBase::build() to create objects of this type at
+ * run time.
+ */
+
+// ------------------------------------------------------------
+// PointLocatorBVH class definition
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+
+  /**
+   * Constructor.  Needs the \p mesh in which the points
+   * should be located.  Optionally takes a master
+   * locator, whose hierarchy is shared instead of
+   * building a new one.
+   */
+  PointLocatorBVH (const MeshBase& mesh,
+                   const PointLocatorBase* master = NULL);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.  This function frees dynamic memory with "delete".
+   */
+  virtual void clear();
+
+  /**
+   * Initializes the locator, so that the \p operator() methods can
+   * be used.  This function allocates dynamic memory with "new".
+   */
+  virtual void init();
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located.  The mutable _element member is used to cache
+   * the result and allow it to be used during the next call to
+   * operator().
+   */
+  virtual const Elem* operator() (const Point& p) const;
+
+  /**
+   * Locates the element containing \p p, checking \p hint first.
+   * If the hierarchy does not find an element, which may happen with
+   * curved elements, the search walks through the neighbors of
+   * \p hint before falling back on a linear search.  This does not
+   * change the locator, so it may be called concurrently.
+   */
+  virtual const Elem* find_element (const Point& p,
+                                    const Elem* hint = NULL) const;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return a NULL pointer instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode (void);
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode (void);
+
+  /**
+   * Returns the number of nodes in the hierarchy.
+   */
+  unsigned int n_nodes () const;
+
+  /**
+   * The number of elements stored in each leaf.
+   */
+  static const unsigned int leaf_size = 4;
+
+  /**
+   * One node of the hierarchy.  A node covers the consecutive range
+   * [\p begin, \p end) of the sorted elements.  Its two children, if
+   * any, are stored next to each other starting at \p first_child.
+   */
+  struct Node
+  {
+    Node () :
+      box (Point(), Point()),
+      begin (0),
+      end (0),
+      first_child (libMesh::invalid_uint)
+    {}
+
+    MeshTools::BoundingBox box;
+    unsigned int begin, end;
+    unsigned int first_child;
+  };
+
+  /**
+   * The hierarchy, which the master locator owns and its servants
+   * share.
+   */
+  struct Hierarchy
+  {
+    /**
+     * The nodes, leaves first and the root last.
+     */
+    std::vector<Node> nodes;
+
+    /**
+     * The active elements in Morton order, and their bounding boxes.
+     */
+    std::vector<const Elem*> elems;
+    std::vector<MeshTools::BoundingBox> boxes;
+  };
+
+protected:
+
+  /**
+   * Pointer to our hierarchy.  It is built at run-time through
+   * \p init().  For servant PointLocators (not master), this simply
+   * points to the hierarchy of the master.
+   */
+  Hierarchy* _hierarchy;
+
+  /**
+   * Pointer to the last element that was found.  Chances are that
+   * this may be close to the next call to \p operator()...
+   */
+  mutable const Elem* _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.  See \p
+   * enable_out_of_mesh_mode() for details.
+   */
+  bool _out_of_mesh_mode;
+
+};
+
+
+// ------------------------------------------------------------
+// PointLocatorBVH inline methods
+inline
+unsigned int PointLocatorBVH::n_nodes () const
+{
+  return _hierarchy ? _hierarchy->nodes.size() : 0;
+}
+
+
+} // namespace libMesh
+
+#endif
@@ -115,6 +115,16 @@ public:
    */
   virtual const Elem* operator() (const Point& p) const;
 
+  /**
+   * Locates the element containing \p p, checking \p hint first.
+   * If the tree does not find an element, which may happen with
+   * curved elements, the search walks through the neighbors of
+   * \p hint before falling back on a linear search.  This does not
+   * change the locator, so it may be called concurrently.
+   */
+  virtual const Elem* find_element (const Point& p,
+                                    const Elem* hint = NULL) const;
+
   /**
    * Enables out-of-mesh mode.  In this mode, if asked to find a point
    * that is contained in no mesh at all, the point locator will
@@ -0,0 +1,254 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __small_vector_h__
+#define __small_vector_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <algorithm> // for std::copy, std::copy_backward, std::swap
+#include <iterator>  // for std::distance
+
+namespace libMesh
+{
+
+/**
+ * This class is a vector of plain data which keeps up to \p N
+ * entries inside the object itself, and only allocates memory from
+ * the heap when it grows beyond that.  The inline entries share their
+ * storage with the heap pointer, so a small vector of a few entries
+ * takes no more room than a \p std::vector header, and no separate
+ * allocation at all.
+ *
+ * Only the parts of the \p std::vector interface which are used in
+ * the library are provided.  Since entries are copied bitwise and
+ * never constructed or destroyed, \p T must be a plain data type.
+ */
+
+// ------------------------------------------------------------
+// SmallVector class definition
+template <typename T, unsigned int N>
+class SmallVector
+{
+public:
+
+  typedef T            value_type;
+  typedef T&           reference;
+  typedef const T&     const_reference;
+  typedef T*           iterator;
+  typedef const T*     const_iterator;
+  typedef unsigned int size_type;
+
+  /**
+   * Constructor.  Creates an empty vector.
+   */
+  SmallVector () : _size(0), _capacity(N) {}
+
+  /**
+   * Constructor.  Creates a vector of \p n copies of \p val.
+   */
+  explicit SmallVector (const size_type n, const T& val = T()) :
+    _size(0), _capacity(N)
+  { this->resize(n, val); }
+
+  /**
+   * Copy-constructor.  The copy only allocates as much memory as it
+   * needs.
+   */
+  SmallVector (const SmallVector& other) :
+    _size(0), _capacity(N)
+  { this->assign(other.begin(), other.end()); }
+
+  /**
+   * Destructor.
+   */
+  ~SmallVector ()
+  { this->deallocate(); }
+
+  /**
+   * Assignment operator.
+   */
+  SmallVector& operator= (const SmallVector& other)
+  {
+    if (this != &other)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  /**
+   * Replaces the contents with the range [first, last).
+   */
+  template <typename InputIterator>
+  void assign (InputIterator first, InputIterator last)
+  {
+    _size = 0;
+    this->reserve(std::distance(first, last));
+    for (; first != last; ++first)
+      this->data()[_size++] = *first;
+  }
+
+  size_type size () const { return _size; }
+
+  bool empty () const { return _size == 0; }
+
+  size_type capacity () const { return _capacity; }
+
+  iterator begin () { return this->data(); }
+  iterator end () { return this->data() + _size; }
+  const_iterator begin () const { return this->data(); }
+  const_iterator end () const { return this->data() + _size; }
+
+  reference operator[] (const size_type i)
+  { return this->data()[i]; }
+
+  const_reference operator[] (const size_type i) const
+  { return this->data()[i]; }
+
+  /**
+   * Makes room for at least \p n entries.
+   */
+  void reserve (const size_type n)
+  {
+    if (n <= _capacity)
+      return;
+
+    T* new_data = new T[n];
+    std::copy(this->begin(), this->end(), new_data);
+    this->deallocate();
+
+    _storage.heap = new_data;
+    _capacity = n;
+  }
+
+  void resize (const size_type n, const T& val = T())
+  {
+    this->reserve(n);
+    if (n > _size)
+      std::fill(this->data() + _size, this->data() + n, val);
+    _size = n;
+  }
+
+  /**
+   * Removes all the entries.  The memory is kept for reuse; swap
+   * with an empty vector to release it.
+   */
+  void clear () { _size = 0; }
+
+  void push_back (const T& val)
+  {
+    this->grow(_size + 1);
+    this->data()[_size++] = val;
+  }
+
+  /**
+   * Inserts \p val before \p pos, and returns an iterator to it.
+   */
+  iterator insert (iterator pos, const T& val)
+  {
+    const size_type i = pos - this->begin();
+    const T copy = val;
+
+    this->grow(_size + 1);
+    std::copy_backward(this->begin() + i, this->end(), this->end() + 1);
+    this->data()[i] = copy;
+    ++_size;
+
+    return this->begin() + i;
+  }
+
+  /**
+   * Inserts the range [first, last), which must not be part of this
+   * vector, before \p pos.
+   */
+  template <typename InputIterator>
+  void insert (iterator pos, InputIterator first, InputIterator last)
+  {
+    const size_type i = pos - this->begin();
+    const size_type n = std::distance(first, last);
+
+    this->grow(_size + n);
+    std::copy_backward(this->begin() + i, this->end(), this->end() + n);
+    std::copy(first, last, this->begin() + i);
+    _size += n;
+  }
+
+  /**
+   * Removes the entries in [first, last), and returns an iterator to
+   * the entry which followed them.
+   */
+  iterator erase (iterator first, iterator last)
+  {
+    std::copy(last, this->end(), first);
+    _size -= (last - first);
+    return first;
+  }
+
+  void swap (SmallVector& other)
+  {
+    std::swap(_storage, other._storage);
+    std::swap(_size, other._size);
+    std::swap(_capacity, other._capacity);
+  }
+
+private:
+
+  bool is_inline () const { return _capacity == N; }
+
+  T* data ()
+  { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  const T* data () const
+  { return this->is_inline() ? _storage.local : _storage.heap; }
+
+  /**
+   * Makes room for \p n entries, at least doubling the capacity when
+   * it has to grow, as \p std::vector does.
+   */
+  void grow (const size_type n)
+  {
+    if (n > _capacity)
+      this->reserve(std::max(n, 2*_capacity));
+  }
+
+  void deallocate ()
+  {
+    if (!this->is_inline())
+      delete [] _storage.heap;
+    _capacity = N;
+  }
+
+  /**
+   * The entries themselves while there are at most \p N of them, and
+   * a pointer to them on the heap otherwise.  The capacity tells which.
+   */
+  union
+  {
+    T local[N];
+    T* heap;
+  } _storage;
+
+  size_type _size;
+  size_type _capacity;
+};
+
+} // namespace libMesh
+
+#endif // #define __small_vector_h__
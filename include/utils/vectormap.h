@@ -0,0 +1,435 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __vectormap_h__
+#define __vectormap_h__
+
+// Local Includes -----------------------------------
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p vectormap templated class is a drop-in replacement for
+ * \p mapvector, with the same vector-like interface and iterators,
+ * but with contiguous storage.
+ *
+ * Values are kept in a dense array in insertion order; erased entries
+ * leave a hole which iterators skip until the next \p compact().
+ * Keys are found through an open-addressing hash table of slot
+ * numbers, so lookups are O(1) and iteration streams through memory
+ * instead of walking the nodes of a red-black tree.
+ *
+ * Like \p mapvector, the non-const \p operator[] inserts a
+ * default-constructed value for a missing key, and inserting or
+ * erasing does not invalidate iterators; entries appended during an
+ * iteration are visited by that iteration.
+ *
+ * Two things differ from \p mapvector, and code moving from one to
+ * the other must allow for them:
+ *
+ * - Iteration is in insertion order, not in key order.  Only
+ *   \p compact() sorts the entries by key, and any insertion after
+ *   it appends out of order again.  Code which needs to visit the
+ *   entries by increasing key has to \p compact() first.
+ *
+ * - The reference returned by the non-const \p operator[], or by
+ *   dereferencing an iterator, is invalidated by any later insertion,
+ *   which may reallocate the value array, and by \p compact().  Copy
+ *   the value out, or look the key up again, instead of holding on to
+ *   the reference.
+ */
+
+template <typename Val>
+class vectormap
+{
+public:
+
+  vectormap () :
+    _keys(),
+    _vals(),
+    _table(),
+    _size(0),
+    _max_key(0),
+    _max_key_is_current(true)
+  {}
+
+  /**
+   * Returns a reference to the value for key \p k, inserting a
+   * default-constructed value if there is none.  The reference is
+   * only valid until the next insertion or \p compact().
+   */
+  Val& operator[] (const unsigned int &k)
+  {
+    unsigned int slot = this->find_slot(k);
+    if (slot == invalid_slot)
+      slot = this->insert_slot(k);
+    return _vals[slot];
+  }
+
+  Val operator[] (const unsigned int &k) const
+  {
+    const unsigned int slot = this->find_slot(k);
+    return slot == invalid_slot ? Val() : _vals[slot];
+  }
+
+  class veclike_iterator
+  {
+  public:
+    veclike_iterator(vectormap<Val> *m, const unsigned int s)
+      : map(m), slot(s) { this->skip_holes(); }
+
+    veclike_iterator(const veclike_iterator &i)
+      : map(i.map), slot(i.slot) {}
+
+    Val& operator*() const { return map->_vals[slot]; }
+
+    unsigned int key() const { return map->_keys[slot]; }
+
+    veclike_iterator& operator++() { ++slot; this->skip_holes(); return *this; }
+
+    veclike_iterator operator++(int) {
+      veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    // Anything at or past the last slot is the end, so the end()
+    // iterator follows entries appended after it was created.
+    bool operator==(const veclike_iterator &other) const {
+      return std::min(slot, map->n_slots()) ==
+             std::min(other.slot, other.map->n_slots());
+    }
+
+    bool operator!=(const veclike_iterator &other) const {
+      return !(*this == other);
+    }
+
+    vectormap<Val> *map;
+    unsigned int slot;
+
+  private:
+    void skip_holes() {
+      while (slot < map->n_slots() && map->_keys[slot] == invalid_key)
+        ++slot;
+    }
+  };
+
+  class const_veclike_iterator
+  {
+  public:
+    const_veclike_iterator(const vectormap<Val> *m, const unsigned int s)
+      : map(m), slot(s) { this->skip_holes(); }
+
+    const_veclike_iterator(const const_veclike_iterator &i)
+      : map(i.map), slot(i.slot) {}
+
+    const_veclike_iterator(const veclike_iterator &i)
+      : map(i.map), slot(i.slot) {}
+
+    const Val& operator*() const { return map->_vals[slot]; }
+
+    unsigned int key() const { return map->_keys[slot]; }
+
+    const_veclike_iterator& operator++() { ++slot; this->skip_holes(); return *this; }
+
+    const_veclike_iterator operator++(int) {
+      const_veclike_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator==(const const_veclike_iterator &other) const {
+      return std::min(slot, map->n_slots()) ==
+             std::min(other.slot, other.map->n_slots());
+    }
+
+    bool operator!=(const const_veclike_iterator &other) const {
+      return !(*this == other);
+    }
+
+    const vectormap<Val> *map;
+    unsigned int slot;
+
+  private:
+    void skip_holes() {
+      while (slot < map->n_slots() && map->_keys[slot] == invalid_key)
+        ++slot;
+    }
+  };
+
+  /**
+   * Returns the number of entries (including any NULL values).
+   */
+  unsigned int size() const { return _size; }
+
+  bool empty() const { return _size == 0; }
+
+  unsigned int count(const unsigned int k) const
+  { return this->find_slot(k) != invalid_slot; }
+
+  /**
+   * Returns the largest key in the container, which must not be empty.
+   */
+  unsigned int max_key() const
+  {
+    libmesh_assert(!this->empty());
+    if (!_max_key_is_current)
+      {
+        _max_key = 0;
+        for (unsigned int s=0; s != this->n_slots(); ++s)
+          if (_keys[s] != invalid_key)
+            _max_key = std::max(_max_key, _keys[s]);
+        _max_key_is_current = true;
+      }
+    return _max_key;
+  }
+
+  void erase(unsigned int k) {
+    const unsigned int slot = this->find_slot(k);
+    if (slot != invalid_slot)
+      this->erase_slot(slot);
+  }
+
+  void erase(const veclike_iterator &pos) {
+    libmesh_assert_equal_to (pos.map, this);
+    libmesh_assert_less (pos.slot, this->n_slots());
+    this->erase_slot(pos.slot);
+  }
+
+  void clear() {
+    std::vector<unsigned int>().swap(_keys);
+    std::vector<Val>().swap(_vals);
+    std::vector<unsigned int>().swap(_table);
+    _size = 0;
+    _max_key = 0;
+    _max_key_is_current = true;
+  }
+
+  /**
+   * Squeezes out the holes left by erased entries and sorts the
+   * remaining entries by key.  This invalidates all iterators, so it
+   * should only be called when nobody is iterating over the container.
+   */
+  void compact() {
+    std::vector<std::pair<unsigned int, Val> > entries;
+    entries.reserve(_size);
+    for (unsigned int s=0; s != this->n_slots(); ++s)
+      if (_keys[s] != invalid_key)
+        entries.push_back(std::make_pair(_keys[s], _vals[s]));
+
+    std::sort(entries.begin(), entries.end(), compare_keys);
+
+    _keys.resize(_size);
+    _vals.resize(_size);
+    for (unsigned int s=0; s != _size; ++s)
+      {
+        _keys[s] = entries[s].first;
+        _vals[s] = entries[s].second;
+      }
+
+    // Give back any memory the holes were using
+    std::vector<unsigned int>(_keys).swap(_keys);
+    std::vector<Val>(_vals).swap(_vals);
+
+    this->rehash(_table.size());
+  }
+
+  /**
+   * Returns an iterator to the entry with key \p k, or \p end() if
+   * there is none.  Unlike \p operator[], this never inserts.
+   */
+  veclike_iterator find(const unsigned int k) {
+    return veclike_iterator(this, this->find_slot(k));
+  }
+
+  const_veclike_iterator find(const unsigned int k) const {
+    return const_veclike_iterator(this, this->find_slot(k));
+  }
+
+  veclike_iterator begin() {
+    return veclike_iterator(this, 0);
+  }
+
+  const_veclike_iterator begin() const {
+    return const_veclike_iterator(this, 0);
+  }
+
+  veclike_iterator end() {
+    return veclike_iterator(this, invalid_slot);
+  }
+
+  const_veclike_iterator end() const {
+    return const_veclike_iterator(this, invalid_slot);
+  }
+
+private:
+
+  static const unsigned int invalid_key  = static_cast<unsigned int>(-1);
+  static const unsigned int invalid_slot = static_cast<unsigned int>(-1);
+
+  static bool compare_keys (const std::pair<unsigned int, Val> &a,
+                            const std::pair<unsigned int, Val> &b)
+  { return a.first < b.first; }
+
+  unsigned int n_slots() const
+  { return static_cast<unsigned int>(_keys.size()); }
+
+  /**
+   * Multiplicative (Fibonacci) hashing into a power-of-two table.
+   */
+  unsigned int bucket(const unsigned int k) const
+  { return (k * 2654435761u) & (static_cast<unsigned int>(_table.size()) - 1); }
+
+  unsigned int find_slot(const unsigned int k) const
+  {
+    if (_table.empty())
+      return invalid_slot;
+
+    const unsigned int mask = static_cast<unsigned int>(_table.size()) - 1;
+    for (unsigned int b = this->bucket(k); _table[b] != invalid_slot;
+         b = (b+1) & mask)
+      if (_keys[_table[b]] == k)
+        return _table[b];
+
+    return invalid_slot;
+  }
+
+  unsigned int insert_slot(const unsigned int k)
+  {
+    libmesh_assert_not_equal_to (k, invalid_key);
+
+    // Keep the table at most half full
+    if (2*(_size+1) > _table.size())
+      this->rehash(std::max(static_cast<std::size_t>(16), 2*_table.size()));
+
+    const unsigned int slot = this->n_slots();
+    _keys.push_back(k);
+    _vals.push_back(Val());
+    _size++;
+
+    const unsigned int mask = static_cast<unsigned int>(_table.size()) - 1;
+    unsigned int b = this->bucket(k);
+    while (_table[b] != invalid_slot)
+      b = (b+1) & mask;
+    _table[b] = slot;
+
+    if (_max_key_is_current)
+      _max_key = (_size == 1) ? k : std::max(_max_key, k);
+
+    return slot;
+  }
+
+  void erase_slot(const unsigned int slot)
+  {
+    const unsigned int k = _keys[slot];
+    libmesh_assert_not_equal_to (k, invalid_key);
+
+    const unsigned int mask = static_cast<unsigned int>(_table.size()) - 1;
+    unsigned int b = this->bucket(k);
+    while (_table[b] != slot)
+      b = (b+1) & mask;
+
+    // Backward-shift deletion keeps probe sequences unbroken without
+    // leaving tombstones in the table
+    _table[b] = invalid_slot;
+    for (unsigned int next = (b+1) & mask; _table[next] != invalid_slot;
+         next = (next+1) & mask)
+      {
+        const unsigned int home = this->bucket(_keys[_table[next]]);
+        const bool movable = (next > b) ?
+          (home <= b || home > next) :
+          (home <= b && home > next);
+        if (movable)
+          {
+            _table[b] = _table[next];
+            _table[next] = invalid_slot;
+            b = next;
+          }
+      }
+
+    _keys[slot] = invalid_key;
+    _vals[slot] = Val();
+    _size--;
+
+    if (_max_key_is_current && k == _max_key)
+      _max_key_is_current = false;
+  }
+
+  void rehash(const std::size_t min_table_size)
+  {
+    std::size_t table_size = 16;
+    while (table_size < min_table_size || table_size < 2*_size)
+      table_size *= 2;
+
+    _table.assign(table_size, invalid_slot);
+
+    const unsigned int mask = static_cast<unsigned int>(table_size) - 1;
+    for (unsigned int s=0; s != this->n_slots(); ++s)
+      if (_keys[s] != invalid_key)
+        {
+          unsigned int b = this->bucket(_keys[s]);
+          while (_table[b] != invalid_slot)
+            b = (b+1) & mask;
+          _table[b] = s;
+        }
+  }
+
+  /**
+   * The key of each slot, or \p invalid_key for an erased slot.
+   */
+  std::vector<unsigned int> _keys;
+
+  /**
+   * The value of each slot, stored separately from the keys so that
+   * iterating over values touches as little memory as possible.
+   */
+  std::vector<Val> _vals;
+
+  /**
+   * Open-addressing hash table of slot numbers.
+   */
+  std::vector<unsigned int> _table;
+
+  /**
+   * The number of (non-erased) entries.
+   */
+  unsigned int _size;
+
+  /**
+   * Cache of the largest key, recomputed lazily after it is erased.
+   */
+  mutable unsigned int _max_key;
+  mutable bool _max_key_is_current;
+};
+
+template <typename Val>
+const unsigned int vectormap<Val>::invalid_key;
+
+template <typename Val>
+const unsigned int vectormap<Val>::invalid_slot;
+
+} // namespace libMesh
+
+#endif // __vectormap_h__
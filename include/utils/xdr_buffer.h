@@ -0,0 +1,127 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2012 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef __xdr_buffer_h__
+#define __xdr_buffer_h__
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Xdr;
+
+/**
+ * This class stands in for an \p Xdr object which is being written
+ * to, and keeps a copy of everything written to it in memory.  The
+ * copy can then be written to a real \p Xdr object later, possibly
+ * from another thread, and long after the data it was taken from has
+ * changed.
+ *
+ * Only the types written to parallel files by
+ * \p System::write_parallel_data() are provided.
+ */
+
+// ------------------------------------------------------------
+// XdrBuffer class definition
+class XdrBuffer
+{
+public:
+
+  /**
+   * Constructor.  Creates an empty buffer.
+   */
+  XdrBuffer ();
+
+  /**
+   * A buffer can only be written to.
+   */
+  bool writing () const { return true; }
+
+  /**
+   * Copies \p a into the buffer, as \p Xdr::data() would write it,
+   * together with its \p comment.
+   */
+  void data (unsigned int &a, const char* comment="");
+
+  void data (std::vector<unsigned int> &a, const char* comment="");
+
+  void data (std::vector<Number> &a, const char* comment="");
+
+  /**
+   * Writes everything in the buffer to \p io, in the order it was
+   * put in.
+   */
+  void write (Xdr &io);
+
+  /**
+   * Empties the buffer.
+   */
+  void clear ();
+
+  /**
+   * Swaps the contents of this buffer with those of \p other.
+   */
+  void swap (XdrBuffer &other);
+
+  /**
+   * @returns the number of bytes of data held in the buffer.
+   */
+  std::size_t n_bytes () const;
+
+private:
+
+  /**
+   * One call to \p data().  A single value is kept as a vector of
+   * length one.
+   */
+  struct Record
+  {
+    enum RecordType { VALUE, UINT_VECTOR, NUMBER_VECTOR };
+
+    RecordType type;
+    std::string comment;
+    std::vector<unsigned int> uints;
+    std::vector<Number> numbers;
+  };
+
+  /**
+   * The records in the order they were put in.  A list is used so
+   * that large records are never copied as more are added.
+   */
+  std::list<Record> _records;
+
+  /**
+   * Appends an empty record of type \p type and returns it.
+   */
+  Record& add_record (const Record::RecordType type,
+                      const char* comment);
+};
+
+} // namespace libMesh
+
+#endif // #define __xdr_buffer_h__
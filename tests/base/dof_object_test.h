@@ -13,6 +13,7 @@
   CPPUNIT_TEST( testInvalidateProcId ); \
   CPPUNIT_TEST( testSetNSystems ); \
   CPPUNIT_TEST( testSetNVariableGroups ); \
+  CPPUNIT_TEST( testAddSystemsAndClear ); \
   CPPUNIT_TEST( testJensEftangBug );
 
 using namespace libMesh;
@@ -121,6 +122,65 @@ public:
       }
   }
 
+  void testAddSystemsAndClear()
+  {
+    DofObject aobject(*instance);
+
+    // One system of one variable group is kept inside the object
+    std::vector<unsigned int> nvpg(1, 3);
+
+    aobject.set_n_systems (1);
+    aobject.set_n_vars_per_group (0, nvpg);
+    aobject.set_n_comp_group (0, 0, 2);
+    aobject.set_vg_dof_base (0, 0, 10);
+
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 15, aobject.dof_number(0,2,1) );
+
+    // More systems and variable groups move it to the heap
+    nvpg.push_back(4);
+
+    for (unsigned int s=1; s<5; s++)
+      {
+	aobject.add_system ();
+	aobject.set_n_vars_per_group (s, nvpg);
+	for (unsigned int vg=0; vg<2; vg++)
+	  {
+	    aobject.set_n_comp_group (s, vg, 1);
+	    aobject.set_vg_dof_base (s, vg, 100*s + 10*vg);
+	  }
+      }
+
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 5, aobject.n_systems() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 15, aobject.dof_number(0,2,1) );
+
+    for (unsigned int s=1; s<5; s++)
+      {
+	CPPUNIT_ASSERT_EQUAL( (unsigned int) 7, aobject.n_vars(s) );
+	CPPUNIT_ASSERT_EQUAL( 100*s + 2,  aobject.dof_number(s,2,0) );
+	CPPUNIT_ASSERT_EQUAL( 100*s + 13, aobject.dof_number(s,6,0) );
+      }
+
+    // Copies of either kind of buffer are independent
+    DofObject bobject(aobject);
+    aobject.set_vg_dof_base (4, 1, 0);
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 413, bobject.dof_number(4,6,0) );
+
+    aobject.clear_dofs ();
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 0, aobject.n_systems() );
+    CPPUNIT_ASSERT( !aobject.has_dofs() );
+
+    // And the object is as good as new afterwards
+    aobject.set_n_systems (2);
+    aobject.set_n_vars_per_group (1, nvpg);
+    aobject.set_n_comp_group (1, 1, 3);
+    aobject.set_vg_dof_base (1, 1, 20);
+
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 0, aobject.n_vars(0) );
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 7, aobject.n_vars(1) );
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 25, aobject.dof_number(1,4,2) );
+    CPPUNIT_ASSERT_EQUAL( (unsigned int) 413, bobject.dof_number(4,6,0) );
+  }
+
   void testJensEftangBug()
   {
     libmesh_here();